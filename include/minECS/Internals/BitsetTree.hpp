@@ -3,9 +3,12 @@
 #include <minECS/Internals/Result.hpp>
 #include <minECS/Internals/Traits.hpp>
 
+#include <array>
 #include <bitset>
 #include <cstdint>
+#include <limits>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace minECS
@@ -20,6 +23,7 @@ namespace minECS
 
         static constexpr SizeType BitsetSize = NBitsetSize;
         static constexpr SizeType BlockSize = 256;
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
 
         static constexpr SizeType RoundedSize = (BitsetSize + 7) / 8 * 8;
         static constexpr SizeType LevelCount = RoundedSize / 8;
@@ -36,13 +40,13 @@ namespace minECS
         ~BitsetTree() = default;
 
         BitsetTree(const BitsetTree& other)
-            : Contiguous(other.Contiguous)
+            : Contiguous(other.Contiguous), Alive(other.Alive), BitArchetypes(other.BitArchetypes), DeadCount(other.DeadCount)
         {
             Root = CloneSubtree(other.Root, Pool);
         }
 
         BitsetTree(BitsetTree&& other) noexcept
-            : Root(other.Root), Pool(std::move(other.Pool)), Contiguous(std::move(other.Contiguous))
+            : Root(other.Root), Pool(std::move(other.Pool)), Contiguous(std::move(other.Contiguous)), Alive(std::move(other.Alive)), BitArchetypes(std::move(other.BitArchetypes)), DeadCount(std::exchange(other.DeadCount, 0))
         {
             other.Root = nullptr;
         }
@@ -59,6 +63,9 @@ namespace minECS
             std::swap(Root, temp.Root);
             std::swap(Pool, temp.Pool);
             std::swap(Contiguous, temp.Contiguous);
+            std::swap(Alive, temp.Alive);
+            std::swap(BitArchetypes, temp.BitArchetypes);
+            std::swap(DeadCount, temp.DeadCount);
 
             return *this;
         }
@@ -75,6 +82,9 @@ namespace minECS
             Root = other.Root;
             Pool = std::move(other.Pool);
             Contiguous = std::move(other.Contiguous);
+            Alive = std::move(other.Alive);
+            BitArchetypes = std::move(other.BitArchetypes);
+            DeadCount = std::exchange(other.DeadCount, 0);
 
             other.Root = nullptr;
 
@@ -88,6 +98,19 @@ namespace minECS
 
         [[nodiscard]] ReferenceResult<Type> Insert(const std::bitset<BitsetSize>& bitset)
         {
+            ValueResult<SizeType> result = InsertIndex(bitset);
+
+            return ReferenceResult<Type>(&Contiguous[result.GetValue()].second, result.Succeeded());
+        }
+
+        [[nodiscard]] ValueResult<SizeType> InsertIndex(const std::bitset<BitsetSize>& bitset)
+        {
+            if (!Root)
+            {
+                Root = Pool.Allocate();
+                *Root = {};
+            }
+
             Node* current = Root;
 
             for (SizeType level = 0; level < LevelCount; level++)
@@ -106,19 +129,35 @@ namespace minECS
 
             if (!current->ArchetypeIndex.has_value())
             {
-                current->ArchetypeIndex = Contiguous.size();
+                SizeType index = Contiguous.size();
+
+                current->ArchetypeIndex = index;
                 Contiguous.emplace_back(bitset, T{});
+                Alive.push_back(true);
+
+                for (SizeType bit = 0; bit < BitsetSize; bit++)
+                {
+                    if (bitset.test(bit))
+                    {
+                        BitArchetypes[bit].push_back(index);
+                    }
+                }
 
-                return ReferenceResult<Type>(&Contiguous[current->ArchetypeIndex.value()].second, true);
+                return ValueResult<SizeType>(index, true);
             }
 
-            return ReferenceResult<Type>(&Contiguous[current->ArchetypeIndex.value()].second, false);
+            return ValueResult<SizeType>(current->ArchetypeIndex.value(), false);
         }
 
         [[nodiscard]] ReferenceResult<Type> Get(const std::bitset<BitsetSize>& bitset)
         {
             Node* current = Root;
 
+            if (!current)
+            {
+                return ReferenceResult<Type>(nullptr, false);
+            }
+
             for (SizeType level = 0; level < LevelCount; level++)
             {
                 std::uint8_t key = GetByte(bitset, level);
@@ -141,10 +180,15 @@ namespace minECS
             return ReferenceResult<Type>(&Contiguous[current->ArchetypeIndex.value()].second, true);
         }
 
-        [[nodiscard]] const ReferenceResult<Type> Get(const std::bitset<BitsetSize>& bitset) const
+        [[nodiscard]] ReferenceResult<const Type> Get(const std::bitset<BitsetSize>& bitset) const
         {
             Node* current = Root;
 
+            if (!current)
+            {
+                return ReferenceResult<const Type>(nullptr, false);
+            }
+
             for (SizeType level = 0; level < LevelCount; level++)
             {
                 std::uint8_t key = GetByte(bitset, level);
@@ -153,7 +197,7 @@ namespace minECS
 
                 if (!next)
                 {
-                    return ReferenceResult<Type>(nullptr, false);
+                    return ReferenceResult<const Type>(nullptr, false);
                 }
 
                 current = next;
@@ -161,10 +205,226 @@ namespace minECS
 
             if (!current->ArchetypeIndex.has_value())
             {
-                return ReferenceResult<Type>(nullptr, false);
+                return ReferenceResult<const Type>(nullptr, false);
             }
 
-            return ReferenceResult<Type>(&Contiguous[current->ArchetypeIndex.value()].second, true);
+            return ReferenceResult<const Type>(&Contiguous[current->ArchetypeIndex.value()].second, true);
+        }
+
+        inline void Pin(const std::bitset<BitsetSize>& bitset)
+        {
+            Node* current = Root;
+
+            for (SizeType level = 0; current && level < LevelCount; level++)
+            {
+                current = current->Children[GetByte(bitset, level)];
+            }
+
+            if (current)
+            {
+                current->Pinned = true;
+            }
+        }
+
+        inline void Unpin(const std::bitset<BitsetSize>& bitset)
+        {
+            Node* current = Root;
+
+            for (SizeType level = 0; current && level < LevelCount; level++)
+            {
+                current = current->Children[GetByte(bitset, level)];
+            }
+
+            if (current)
+            {
+                current->Pinned = false;
+            }
+        }
+
+        [[nodiscard]] inline bool IsPinned(const std::bitset<BitsetSize>& bitset) const
+        {
+            const Node* current = Root;
+
+            for (SizeType level = 0; current && level < LevelCount; level++)
+            {
+                current = current->Children[GetByte(bitset, level)];
+            }
+
+            return current && current->Pinned;
+        }
+
+        template <typename TFunction>
+        inline void ForEachMatching(const std::bitset<BitsetSize>& mask, TFunction&& function, SizeType firstIndex = 0)
+        {
+            const std::vector<SizeType>* candidates = nullptr;
+
+            for (SizeType bit = 0; bit < BitsetSize; bit++)
+            {
+                if (mask.test(bit) && (!candidates || BitArchetypes[bit].size() < candidates->size()))
+                {
+                    candidates = &BitArchetypes[bit];
+                }
+            }
+
+            if (!candidates)
+            {
+                for (SizeType index = firstIndex; index < Contiguous.size(); index++)
+                {
+                    if (Alive[index])
+                    {
+                        function(Contiguous[index].first, Contiguous[index].second);
+                    }
+                }
+
+                return;
+            }
+
+            for (SizeType i = 0; i < candidates->size(); i++)
+            {
+                SizeType index = (*candidates)[i];
+
+                if (index < firstIndex)
+                {
+                    continue;
+                }
+
+                auto& [bitset, value] = Contiguous[index];
+
+                if ((bitset & mask) == mask)
+                {
+                    function(bitset, value);
+                }
+            }
+        }
+
+        [[nodiscard]] inline std::vector<SizeType> Match(const std::bitset<BitsetSize>& mask) const
+        {
+            std::vector<SizeType> matches;
+            const std::vector<SizeType>* candidates = nullptr;
+
+            for (SizeType bit = 0; bit < BitsetSize; bit++)
+            {
+                if (mask.test(bit) && (!candidates || BitArchetypes[bit].size() < candidates->size()))
+                {
+                    candidates = &BitArchetypes[bit];
+                }
+            }
+
+            if (!candidates)
+            {
+                for (SizeType index = 0; index < Contiguous.size(); index++)
+                {
+                    if (Alive[index])
+                    {
+                        matches.push_back(index);
+                    }
+                }
+
+                return matches;
+            }
+
+            for (const SizeType& index : *candidates)
+            {
+                if ((Contiguous[index].first & mask) == mask)
+                {
+                    matches.push_back(index);
+                }
+            }
+
+            return matches;
+        }
+
+        [[nodiscard]] ValueResult<SizeType> Find(const std::bitset<BitsetSize>& bitset) const
+        {
+            Node* current = Root;
+
+            for (SizeType level = 0; current && level < LevelCount; level++)
+            {
+                current = current->Children[GetByte(bitset, level)];
+            }
+
+            if (!current || !current->ArchetypeIndex.has_value())
+            {
+                return ValueResult<SizeType>(DeadIndex, false);
+            }
+
+            return ValueResult<SizeType>(current->ArchetypeIndex.value(), true);
+        }
+
+        [[nodiscard]] std::vector<SizeType> Compact()
+        {
+            std::vector<SizeType> remap(Contiguous.size(), DeadIndex);
+
+            SizeType next = 0;
+
+            for (SizeType index = 0; index < Contiguous.size(); index++)
+            {
+                if (!Alive[index])
+                {
+                    continue;
+                }
+
+                if (index != next)
+                {
+                    Contiguous[next] = std::move(Contiguous[index]);
+                }
+
+                remap[index] = next++;
+            }
+
+            Contiguous.erase(Contiguous.begin() + next, Contiguous.end());
+            Alive.assign(next, true);
+
+            for (auto& archetypes : BitArchetypes)
+            {
+                for (auto& index : archetypes)
+                {
+                    index = remap[index];
+                }
+            }
+
+            RemapRecursive(Root, remap, 0);
+
+            DeadCount = 0;
+
+            return remap;
+        }
+
+        inline void Reserve(SizeType archetypes, SizeType nodes)
+        {
+            Contiguous.reserve(archetypes);
+            Alive.reserve(archetypes);
+            Pool.Reserve(nodes);
+        }
+
+        [[nodiscard]] inline SizeType GetNodeCapacity() const
+        {
+            return Pool.Capacity();
+        }
+
+        [[nodiscard]] inline SizeType GetDeadCount() const
+        {
+            return DeadCount;
+        }
+
+        [[nodiscard]] inline std::pair<std::bitset<BitsetSize>, Type>& At(SizeType index)
+        {
+            return Contiguous[index];
+        }
+
+        [[nodiscard]] inline const std::pair<std::bitset<BitsetSize>, Type>& At(SizeType index) const
+        {
+            return Contiguous[index];
+        }
+
+        [[nodiscard]] inline bool IsAlive(SizeType index) const
+        {
+            return index < Alive.size() && Alive[index];
+        }
+
+        [[nodiscard]] inline SizeType Size() const
+        {
+            return Contiguous.size();
         }
 
         [[nodiscard]] Iterator begin()
@@ -192,6 +452,8 @@ namespace minECS
         {
             std::array<Node*, 256> Children{};
             std::optional<SizeType> ArchetypeIndex;
+
+            bool Pinned = false;
         };
 
         class NodePool
@@ -210,11 +472,23 @@ namespace minECS
                 }
             }
 
-            NodePool(const NodePool&) = default;
-            NodePool(NodePool&&) noexcept = default;
+            NodePool(const NodePool&) = delete;
+
+            NodePool(NodePool&& other) noexcept
+                : Blocks(std::move(other.Blocks)), FreeList(std::move(other.FreeList)), Index(std::exchange(other.Index, BlockSize))
+            {
+            }
 
-            NodePool& operator=(const NodePool&) = default;
-            NodePool& operator=(NodePool&&) noexcept = default;
+            NodePool& operator=(const NodePool&) = delete;
+
+            NodePool& operator=(NodePool&& other) noexcept
+            {
+                std::swap(Blocks, other.Blocks);
+                std::swap(FreeList, other.FreeList);
+                std::swap(Index, other.Index);
+
+                return *this;
+            }
 
             [[nodiscard]] Node* Allocate()
             {
@@ -240,6 +514,27 @@ namespace minECS
                 FreeList.push_back(ptr);
             }
 
+            void Reserve(SizeType count)
+            {
+                while (Capacity() < count)
+                {
+                    Node* block = new Node[BlockSize];
+
+                    Blocks.insert(Blocks.begin(), block);
+                    FreeList.reserve(FreeList.size() + BlockSize);
+
+                    for (SizeType i = BlockSize; i > 0; i--)
+                    {
+                        FreeList.push_back(&block[i - 1]);
+                    }
+                }
+            }
+
+            [[nodiscard]] SizeType Capacity() const
+            {
+                return Blocks.size() * BlockSize;
+            }
+
         private:
             void AllocateBlock()
             {
@@ -304,6 +599,16 @@ namespace minECS
 
             if (level == LevelCount)
             {
+                if (current->Pinned)
+                {
+                    return false;
+                }
+
+                if (current->ArchetypeIndex.has_value())
+                {
+                    Unlink(current->ArchetypeIndex.value());
+                }
+
                 current->ArchetypeIndex.reset();
             }
             else
@@ -334,6 +639,60 @@ namespace minECS
             return true;
         }
 
+        inline void Unlink(SizeType index)
+        {
+            const std::bitset<BitsetSize>& bitset = Contiguous[index].first;
+
+            for (SizeType bit = 0; bit < BitsetSize; bit++)
+            {
+                if (!bitset.test(bit))
+                {
+                    continue;
+                }
+
+                std::vector<SizeType>& archetypes = BitArchetypes[bit];
+
+                for (SizeType i = 0; i < archetypes.size(); i++)
+                {
+                    if (archetypes[i] == index)
+                    {
+                        archetypes[i] = archetypes.back();
+                        archetypes.pop_back();
+
+                        break;
+                    }
+                }
+            }
+
+            Contiguous[index].second = Type{};
+            Alive[index] = false;
+
+            DeadCount++;
+        }
+
+        void RemapRecursive(Node* current, const std::vector<SizeType>& remap, SizeType level)
+        {
+            if (!current)
+            {
+                return;
+            }
+
+            if (level == LevelCount)
+            {
+                if (current->ArchetypeIndex.has_value())
+                {
+                    current->ArchetypeIndex = remap[current->ArchetypeIndex.value()];
+                }
+
+                return;
+            }
+
+            for (auto* child : current->Children)
+            {
+                RemapRecursive(child, remap, level + 1);
+            }
+        }
+
         [[nodiscard]] Node* CloneSubtree(const Node* source, NodePool& pool)
         {
             if (!source)
@@ -342,7 +701,9 @@ namespace minECS
             }
 
             Node* clone = pool.Allocate();
+            *clone = {};
             clone->ArchetypeIndex = source->ArchetypeIndex;
+            clone->Pinned = source->Pinned;
 
             for (SizeType i = 0; i < 256; i++)
             {
@@ -359,5 +720,10 @@ namespace minECS
         NodePool Pool;
 
         std::vector<std::pair<std::bitset<BitsetSize>, Type>> Contiguous;
+        std::vector<bool> Alive;
+
+        std::array<std::vector<SizeType>, BitsetSize> BitArchetypes;
+
+        SizeType DeadCount = 0;
     };
 }
\ No newline at end of file
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace minECS
+{
+    class CapacityProfile
+    {
+    public:
+        static constexpr std::uint32_t Version = 1;
+
+        inline void RecordEntities(std::uint64_t count)
+        {
+            Entities = count > Entities ? count : Entities;
+        }
+
+        inline void RecordNodes(std::uint64_t count)
+        {
+            Nodes = count > Nodes ? count : Nodes;
+        }
+
+        inline void RecordComponent(std::size_t index, std::uint64_t count)
+        {
+            if (index >= Components.size())
+            {
+                Components.resize(index + 1, 0);
+            }
+
+            Components[index] = count > Components[index] ? count : Components[index];
+        }
+
+        inline void RecordArchetype(const std::string& mask, std::uint64_t count)
+        {
+            std::uint64_t& current = Archetypes[mask];
+
+            current = count > current ? count : current;
+        }
+
+        [[nodiscard]] inline std::uint64_t GetEntities() const
+        {
+            return Entities;
+        }
+
+        [[nodiscard]] inline std::uint64_t GetNodes() const
+        {
+            return Nodes;
+        }
+
+        [[nodiscard]] inline std::uint64_t GetComponent(std::size_t index) const
+        {
+            return index < Components.size() ? Components[index] : 0;
+        }
+
+        [[nodiscard]] inline std::size_t GetComponentCount() const
+        {
+            return Components.size();
+        }
+
+        [[nodiscard]] inline const std::map<std::string, std::uint64_t>& GetArchetypes() const
+        {
+            return Archetypes;
+        }
+
+        [[nodiscard]] inline bool Save(const std::string& path) const
+        {
+            std::ofstream file(path, std::ios::trunc);
+
+            if (!file)
+            {
+                std::cerr << "Failed to open capacity profile " << path << "\n";
+
+                return false;
+            }
+
+            file << "minECS-capacity " << Version << "\n";
+            file << "entities " << Entities << "\n";
+            file << "nodes " << Nodes << "\n";
+
+            for (std::size_t index = 0; index < Components.size(); index++)
+            {
+                file << "component " << index << " " << Components[index] << "\n";
+            }
+
+            for (const auto& [mask, count] : Archetypes)
+            {
+                file << "archetype " << mask << " " << count << "\n";
+            }
+
+            return static_cast<bool>(file);
+        }
+
+        [[nodiscard]] inline bool Load(const std::string& path)
+        {
+            std::ifstream file(path);
+
+            if (!file)
+            {
+                std::cerr << "Failed to open capacity profile " << path << "\n";
+
+                return false;
+            }
+
+            std::string header;
+            std::uint32_t version = 0;
+
+            if (!(file >> header >> version) || header != "minECS-capacity" || version != Version)
+            {
+                std::cerr << "Invalid capacity profile " << path << "\n";
+
+                return false;
+            }
+
+            std::string key;
+
+            while (file >> key)
+            {
+                bool parsed = false;
+
+                if (key == "entities")
+                {
+                    std::uint64_t count = 0;
+
+                    parsed = static_cast<bool>(file >> count);
+
+                    RecordEntities(count);
+                }
+                else if (key == "nodes")
+                {
+                    std::uint64_t count = 0;
+
+                    parsed = static_cast<bool>(file >> count);
+
+                    RecordNodes(count);
+                }
+                else if (key == "component")
+                {
+                    std::size_t index = 0;
+                    std::uint64_t count = 0;
+
+                    parsed = static_cast<bool>(file >> index >> count);
+
+                    if (parsed)
+                    {
+                        RecordComponent(index, count);
+                    }
+                }
+                else if (key == "archetype")
+                {
+                    std::string mask;
+                    std::uint64_t count = 0;
+
+                    parsed = static_cast<bool>(file >> mask >> count) && mask.find_first_not_of("01") == std::string::npos;
+
+                    if (parsed)
+                    {
+                        RecordArchetype(mask, count);
+                    }
+                }
+
+                if (!parsed)
+                {
+                    std::cerr << "Invalid capacity profile entry " << key << " in " << path << "\n";
+
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        inline void Clear()
+        {
+            Entities = 0;
+            Nodes = 0;
+
+            Components.clear();
+            Archetypes.clear();
+        }
+
+    private:
+        std::uint64_t Entities = 0;
+        std::uint64_t Nodes = 0;
+
+        std::vector<std::uint64_t> Components;
+        std::map<std::string, std::uint64_t> Archetypes;
+    };
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <minECS/Internals/Entity.hpp>
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/SparseSet.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <limits>
+#include <map>
+#include <ranges>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace minECS
+{
+    template <typename TComponent, typename TSizeType>
+    requires CanBeComponent<TComponent> && IsSizeType<TSizeType>
+    class ComponentIndex
+    {
+    public:
+        using ComponentType = TComponent;
+        using SizeType = TSizeType;
+        using EntityType = Entity<SizeType>;
+
+        ComponentIndex() = default;
+        virtual ~ComponentIndex() = default;
+
+        ComponentIndex(const ComponentIndex&) = delete;
+        ComponentIndex(ComponentIndex&&) noexcept = delete;
+
+        ComponentIndex& operator=(const ComponentIndex&) = delete;
+        ComponentIndex& operator=(ComponentIndex&&) noexcept = delete;
+
+        virtual void Insert(EntityType entity, const TComponent& component) = 0;
+        virtual void Update(EntityType entity, const TComponent& component) = 0;
+        virtual void Remove(EntityType entity) = 0;
+        virtual void Clear() = 0;
+    };
+
+    template <typename TComponent, typename TSizeType, typename TKeyFunction, typename TMap>
+    requires CanBeComponent<TComponent> && IsSizeType<TSizeType>
+    class BasicComponentIndex : public ComponentIndex<TComponent, TSizeType>
+    {
+    public:
+        using SizeType = TSizeType;
+        using EntityType = Entity<SizeType>;
+        using KeyType = typename TMap::key_type;
+        using MapType = TMap;
+        using RangeType = std::ranges::subrange<typename MapType::const_iterator>;
+
+        explicit BasicComponentIndex(TKeyFunction keyFunction)
+            : KeyFunction(std::move(keyFunction))
+        {
+        }
+
+        void Insert(EntityType entity, const TComponent& component) override
+        {
+            KeyType key = KeyFunction(component);
+
+            if (Keys.Contains(entity.GetID()))
+            {
+                Erase(entity);
+            }
+
+            Map.emplace(key, entity);
+
+            static_cast<void>(Keys.Insert(entity.GetID(), std::move(key)));
+        }
+
+        void Update(EntityType entity, const TComponent& component) override
+        {
+            ReferenceResult<KeyType> result = Keys.Get(entity.GetID());
+
+            if (result.Failed())
+            {
+                Insert(entity, component);
+
+                return;
+            }
+
+            KeyType key = KeyFunction(component);
+
+            if (key == result.GetValue())
+            {
+                return;
+            }
+
+            EraseFromMap(result.GetValue(), entity);
+
+            Map.emplace(key, entity);
+
+            result.GetValue() = std::move(key);
+        }
+
+        void Remove(EntityType entity) override
+        {
+            if (Keys.Contains(entity.GetID()))
+            {
+                Erase(entity);
+            }
+        }
+
+        void Clear() override
+        {
+            Map.clear();
+            Keys.Clear();
+        }
+
+        [[nodiscard]] inline RangeType Find(const KeyType& key) const
+        {
+            auto [first, last] = Map.equal_range(key);
+
+            return RangeType(first, last);
+        }
+
+        [[nodiscard]] inline ValueResult<EntityType> FindFirst(const KeyType& key) const
+        {
+            auto iterator = Map.find(key);
+
+            if (iterator == Map.end())
+            {
+                return ValueResult<EntityType>(EntityType(std::numeric_limits<SizeType>::max(), 0), false);
+            }
+
+            return ValueResult<EntityType>(iterator->second, true);
+        }
+
+        [[nodiscard]] inline SizeType Count(const KeyType& key) const
+        {
+            return Map.count(key);
+        }
+
+        [[nodiscard]] inline RangeType FindRange(const KeyType& lower, const KeyType& upper) const
+        requires requires(const MapType& map, const KeyType& key) { map.lower_bound(key); }
+        {
+            return RangeType(Map.lower_bound(lower), Map.upper_bound(upper));
+        }
+
+        [[nodiscard]] inline SizeType Size() const
+        {
+            return Map.size();
+        }
+
+        [[nodiscard]] inline const MapType& GetMap() const
+        {
+            return Map;
+        }
+
+    private:
+        inline void Erase(EntityType entity)
+        {
+            EraseFromMap(Keys.Get(entity.GetID()).GetValue(), entity);
+
+            static_cast<void>(Keys.Remove(entity.GetID()));
+        }
+
+        inline void EraseFromMap(const KeyType& key, EntityType entity)
+        {
+            auto [first, last] = Map.equal_range(key);
+
+            for (auto iterator = first; iterator != last; ++iterator)
+            {
+                if (iterator->second.GetID() == entity.GetID())
+                {
+                    Map.erase(iterator);
+
+                    return;
+                }
+            }
+        }
+
+        TKeyFunction KeyFunction;
+
+        MapType Map;
+
+        SparseSet<KeyType, SizeType> Keys;
+    };
+
+    template <typename TComponent, typename TSizeType, typename TKeyFunction>
+    using HashIndex = BasicComponentIndex<TComponent, TSizeType, TKeyFunction, std::unordered_multimap<std::remove_cvref_t<std::invoke_result_t<TKeyFunction, const TComponent&>>, Entity<TSizeType>>>;
+
+    template <typename TComponent, typename TSizeType, typename TKeyFunction>
+    using OrderedIndex = BasicComponentIndex<TComponent, TSizeType, TKeyFunction, std::multimap<std::remove_cvref_t<std::invoke_result_t<TKeyFunction, const TComponent&>>, Entity<TSizeType>>>;
+}
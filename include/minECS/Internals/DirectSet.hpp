@@ -0,0 +1,268 @@
+#pragma once
+
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename T, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class DirectSet
+    {
+    public:
+        using Type = T;
+        using SizeType = TSizeType;
+
+        static_assert(std::is_default_constructible_v<Type>, "Direct storage requires default constructible components");
+
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
+        static constexpr SizeType WordSize = 64;
+
+        inline DirectSet() = default;
+        inline ~DirectSet() = default;
+
+        inline DirectSet(const DirectSet&) = default;
+        inline DirectSet& operator=(const DirectSet&) = default;
+
+        inline DirectSet(DirectSet&&) noexcept = default;
+        inline DirectSet& operator=(DirectSet&&) noexcept = default;
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, const Type& element)
+        {
+            return Emplace(index, element);
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, Type&& element)
+        {
+            return Emplace(index, std::move(element));
+        }
+
+        template <typename... TArgs>
+        [[nodiscard]] inline ReferenceResult<Type> Emplace(SizeType index, TArgs&&... args)
+        {
+            if (index >= Data.size())
+            {
+                Type value(std::forward<TArgs>(args)...);
+
+                Data.resize(index + 1);
+                Present.resize(index / WordSize + 1, 0);
+
+                Data[index] = std::move(value);
+                Present[index / WordSize] |= Bit(index);
+                Count++;
+
+                return ReferenceResult<Type>(&Data[index], true);
+            }
+
+            if (Contains(index))
+            {
+                return ReferenceResult<Type>(&Data[index], false);
+            }
+
+            Data[index] = Type(std::forward<TArgs>(args)...);
+            Present[index / WordSize] |= Bit(index);
+            Count++;
+
+            return ReferenceResult<Type>(&Data[index], true);
+        }
+
+        inline void Fill(const std::vector<SizeType>& indices, const Type& element)
+        {
+            Type value = element;
+
+            for (const SizeType& index : indices)
+            {
+                static_cast<void>(Emplace(index, value));
+            }
+        }
+
+        template <typename TRemap>
+        inline void Merge(DirectSet& other, TRemap&& remap)
+        {
+            other.ForEach([this, &remap](SizeType index, Type& element)
+            {
+                static_cast<void>(Emplace(remap(index), std::move(element)));
+            });
+
+            other.Clear();
+        }
+
+        [[nodiscard]] inline bool Remove(SizeType index)
+        {
+            if (!Contains(index))
+            {
+                return false;
+            }
+
+            Data[index] = Type();
+            Present[index / WordSize] &= ~Bit(index);
+            Count--;
+
+            return true;
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Get(SizeType index)
+        {
+            if (!Contains(index))
+            {
+                return ReferenceResult<Type>(nullptr, false);
+            }
+
+            return ReferenceResult<Type>(&Data[index], true);
+        }
+
+        [[nodiscard]] inline ReferenceResult<const Type> Get(SizeType index) const
+        {
+            if (!Contains(index))
+            {
+                return ReferenceResult<const Type>(nullptr, false);
+            }
+
+            return ReferenceResult<const Type>(&Data[index], true);
+        }
+
+        [[nodiscard]] inline Type& GetUnchecked(SizeType index)
+        {
+            return Data[index];
+        }
+
+        [[nodiscard]] inline const Type& GetUnchecked(SizeType index) const
+        {
+            return Data[index];
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function)
+        {
+            ForEachIndex([this, &function](SizeType index)
+            {
+                function(index, Data[index]);
+            });
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function) const
+        {
+            ForEachIndex([this, &function](SizeType index)
+            {
+                function(index, Data[index]);
+            });
+        }
+
+        template <typename TFunction>
+        inline void ForEachIndex(TFunction&& function) const
+        {
+            for (SizeType word = 0; word < Present.size(); word++)
+            {
+                std::uint64_t bits = Present[word];
+
+                while (bits)
+                {
+                    function(static_cast<SizeType>(word * WordSize + std::countr_zero(bits)));
+
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+        [[nodiscard]] inline bool Contains(SizeType index) const
+        {
+            return index < Data.size() && (Present[index / WordSize] & Bit(index)) != 0;
+        }
+
+        [[nodiscard]] inline std::vector<Type>& GetData()
+        {
+            return Data;
+        }
+
+        [[nodiscard]] inline const std::vector<Type>& GetData() const
+        {
+            return Data;
+        }
+
+        [[nodiscard]] inline const std::vector<std::uint64_t>& GetPresence() const
+        {
+            return Present;
+        }
+
+        [[nodiscard]] inline SizeType Size() const
+        {
+            return Count;
+        }
+
+        [[nodiscard]] inline bool Empty() const
+        {
+            return Count == 0;
+        }
+
+        inline void Clear()
+        {
+            Data.clear();
+            Present.clear();
+
+            Count = 0;
+        }
+
+        inline void Arrange(const std::vector<SizeType>&)
+        {
+        }
+
+        inline void Reserve(SizeType count)
+        {
+            Data.reserve(count);
+            Present.reserve(count / WordSize + 1);
+        }
+
+        inline void ShrinkToFit()
+        {
+            Data.shrink_to_fit();
+            Present.shrink_to_fit();
+        }
+
+        inline void Trim()
+        {
+            SizeType words = static_cast<SizeType>(Present.size());
+
+            while (words > 0 && Present[words - 1] == 0)
+            {
+                words--;
+            }
+
+            SizeType highest = words == 0 ? 0 : static_cast<SizeType>((words - 1) * WordSize + WordSize - std::countl_zero(Present[words - 1]));
+
+            if (Data.capacity() > MinimumCapacity && highest * ShrinkFactor < Data.capacity())
+            {
+                Data.resize(highest);
+                Present.resize(words);
+
+                ShrinkToFit();
+            }
+        }
+
+        [[nodiscard]] inline std::size_t MemoryUsage() const
+        {
+            return Data.capacity() * sizeof(Type) + Present.capacity() * sizeof(std::uint64_t);
+        }
+
+    private:
+        static constexpr SizeType MinimumCapacity = 64;
+        static constexpr SizeType ShrinkFactor = 4;
+
+        [[nodiscard]] static inline std::uint64_t Bit(SizeType index)
+        {
+            return std::uint64_t(1) << (index % WordSize);
+        }
+
+        std::vector<Type> Data;
+        std::vector<std::uint64_t> Present;
+
+        SizeType Count = 0;
+    };
+}
@@ -0,0 +1,410 @@
+#pragma once
+
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/SparseSet.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename T, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class DoubleBufferedSet
+    {
+    public:
+        using Type = T;
+        using SizeType = TSizeType;
+        using BackType = SparseSet<Type, SizeType>;
+
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
+        static constexpr SizeType BlockSize = 64;
+
+    private:
+        struct Buffer
+        {
+            std::vector<Type> Dense;
+            std::vector<SizeType> Sparse;
+            std::vector<SizeType> ReverseMapping;
+
+            std::uint64_t Epoch = 0;
+        };
+
+    public:
+        class FrontView
+        {
+        public:
+            using ConstIterator = typename std::vector<Type>::const_iterator;
+
+            [[nodiscard]] inline ReferenceResult<const Type> Get(SizeType index) const
+            {
+                if (!Contains(index))
+                {
+                    return ReferenceResult<const Type>(nullptr, false);
+                }
+
+                return ReferenceResult<const Type>(&Data->Dense[Data->Sparse[index]], true);
+            }
+
+            [[nodiscard]] inline const Type& GetUnchecked(SizeType index) const
+            {
+                return Data->Dense[Data->Sparse[index]];
+            }
+
+            [[nodiscard]] inline bool Contains(SizeType index) const
+            {
+                return index < Data->Sparse.size() && Data->Sparse[index] != DeadIndex;
+            }
+
+            template <typename TFunction>
+            inline void ForEach(TFunction&& function) const
+            {
+                for (SizeType i = 0; i < Data->Dense.size(); i++)
+                {
+                    function(Data->ReverseMapping[i], Data->Dense[i]);
+                }
+            }
+
+            [[nodiscard]] inline ConstIterator begin() const noexcept
+            {
+                return Data->Dense.cbegin();
+            }
+
+            [[nodiscard]] inline ConstIterator end() const noexcept
+            {
+                return Data->Dense.cend();
+            }
+
+            [[nodiscard]] inline const std::vector<Type>& GetDense() const
+            {
+                return Data->Dense;
+            }
+
+            [[nodiscard]] inline const std::vector<SizeType>& GetReverseMapping() const
+            {
+                return Data->ReverseMapping;
+            }
+
+            [[nodiscard]] inline SizeType Size() const
+            {
+                return static_cast<SizeType>(Data->Dense.size());
+            }
+
+            [[nodiscard]] inline bool Empty() const
+            {
+                return Data->Dense.empty();
+            }
+
+        private:
+            friend class DoubleBufferedSet;
+
+            FrontView(const Buffer* data)
+                : Data(data)
+            {
+            }
+
+            const Buffer* Data;
+        };
+
+        inline DoubleBufferedSet() = default;
+        inline ~DoubleBufferedSet() = default;
+
+        DoubleBufferedSet(const DoubleBufferedSet&) = delete;
+        DoubleBufferedSet& operator=(const DoubleBufferedSet&) = delete;
+
+        inline DoubleBufferedSet(DoubleBufferedSet&& other) noexcept
+            : Back(std::move(other.Back)), Buffers(std::move(other.Buffers)), BlockEpochs(std::move(other.BlockEpochs)),
+              Epoch(other.Epoch), StructureEpoch(other.StructureEpoch), ResetEpoch(other.ResetEpoch),
+              WriteIndex(other.WriteIndex), ReadIndex(other.ReadIndex), Ready(other.Ready.load(std::memory_order_acquire))
+        {
+        }
+
+        inline DoubleBufferedSet& operator=(DoubleBufferedSet&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Back = std::move(other.Back);
+                Buffers = std::move(other.Buffers);
+                BlockEpochs = std::move(other.BlockEpochs);
+                Epoch = other.Epoch;
+                StructureEpoch = other.StructureEpoch;
+                ResetEpoch = other.ResetEpoch;
+                WriteIndex = other.WriteIndex;
+                ReadIndex = other.ReadIndex;
+                Ready.store(other.Ready.load(std::memory_order_acquire), std::memory_order_release);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, const Type& element)
+        {
+            return Emplace(index, element);
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, Type&& element)
+        {
+            return Emplace(index, std::move(element));
+        }
+
+        template <typename... TArgs>
+        [[nodiscard]] inline ReferenceResult<Type> Emplace(SizeType index, TArgs&&... args)
+        {
+            ReferenceResult<Type> result = Back.Emplace(index, std::forward<TArgs>(args)...);
+
+            if (!result.Failed())
+            {
+                MarkStructure();
+                MarkDense(Back.Size() - 1);
+            }
+
+            return result;
+        }
+
+        inline void Fill(const std::vector<SizeType>& indices, const Type& element)
+        {
+            Back.Fill(indices, element);
+
+            MarkAll();
+        }
+
+        template <typename TRemap>
+        inline void Merge(DoubleBufferedSet& other, TRemap&& remap)
+        {
+            Back.Merge(other.Back, std::forward<TRemap>(remap));
+
+            MarkAll();
+            other.MarkAll();
+        }
+
+        [[nodiscard]] inline bool Remove(SizeType index)
+        {
+            if (!Back.Contains(index))
+            {
+                return false;
+            }
+
+            MarkDense(Back.GetSparse()[index]);
+            MarkStructure();
+
+            return Back.Remove(index);
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Get(SizeType index)
+        {
+            if (!Back.Contains(index))
+            {
+                return ReferenceResult<Type>(nullptr, false);
+            }
+
+            MarkDense(Back.GetSparse()[index]);
+
+            return ReferenceResult<Type>(&GetUnchecked(index), true);
+        }
+
+        [[nodiscard]] inline ReferenceResult<const Type> Get(SizeType index) const
+        {
+            return Back.Get(index);
+        }
+
+        [[nodiscard]] inline Type& GetUnchecked(SizeType index)
+        {
+            return Back.GetUnchecked(index);
+        }
+
+        [[nodiscard]] inline const Type& GetUnchecked(SizeType index) const
+        {
+            return Back.GetUnchecked(index);
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function)
+        {
+            MarkAll();
+
+            Back.ForEach(std::forward<TFunction>(function));
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function) const
+        {
+            Back.ForEach(std::forward<TFunction>(function));
+        }
+
+        [[nodiscard]] inline bool Contains(SizeType index) const
+        {
+            return Back.Contains(index);
+        }
+
+        inline void MarkWritten()
+        {
+            MarkAll();
+        }
+
+        inline void SwapBuffers()
+        {
+            Buffer& buffer = Buffers[WriteIndex];
+
+            if (StructureEpoch > buffer.Epoch || ResetEpoch > buffer.Epoch)
+            {
+                buffer.Sparse = Back.GetSparse();
+                buffer.ReverseMapping = Back.GetReverseMapping();
+            }
+
+            const std::vector<Type>& dense = Back.GetDense();
+
+            if (buffer.Dense.size() > dense.size())
+            {
+                buffer.Dense.erase(buffer.Dense.begin() + dense.size(), buffer.Dense.end());
+            }
+
+            SizeType copied = static_cast<SizeType>(buffer.Dense.size());
+
+            for (SizeType block = 0; block * BlockSize < copied; block++)
+            {
+                if (BlockEpochs[block] <= buffer.Epoch && ResetEpoch <= buffer.Epoch)
+                {
+                    continue;
+                }
+
+                SizeType first = block * BlockSize;
+                SizeType last = first + BlockSize < copied ? first + BlockSize : copied;
+
+                std::copy(dense.begin() + first, dense.begin() + last, buffer.Dense.begin() + first);
+            }
+
+            buffer.Dense.insert(buffer.Dense.end(), dense.begin() + copied, dense.end());
+            buffer.Epoch = Epoch++;
+
+            WriteIndex = Ready.exchange(WriteIndex | FreshFlag, std::memory_order_acq_rel) & IndexMask;
+        }
+
+        [[nodiscard]] inline FrontView AcquireFront()
+        {
+            if (Ready.load(std::memory_order_relaxed) & FreshFlag)
+            {
+                ReadIndex = Ready.exchange(ReadIndex, std::memory_order_acq_rel) & IndexMask;
+            }
+
+            return FrontView(&Buffers[ReadIndex]);
+        }
+
+        [[nodiscard]] inline BackType& GetBack()
+        {
+            MarkAll();
+
+            return Back;
+        }
+
+        [[nodiscard]] inline const BackType& GetBack() const
+        {
+            return Back;
+        }
+
+        [[nodiscard]] inline const std::vector<SizeType>& GetSparse() const
+        {
+            return Back.GetSparse();
+        }
+
+        [[nodiscard]] inline const std::vector<SizeType>& GetReverseMapping() const
+        {
+            return Back.GetReverseMapping();
+        }
+
+        [[nodiscard]] inline SizeType Size() const
+        {
+            return Back.Size();
+        }
+
+        [[nodiscard]] inline bool Empty() const
+        {
+            return Back.Empty();
+        }
+
+        inline void Clear()
+        {
+            Back.Clear();
+            BlockEpochs.clear();
+
+            MarkAll();
+        }
+
+        inline void Arrange(const std::vector<SizeType>& order)
+        {
+            Back.Arrange(order);
+
+            MarkAll();
+        }
+
+        inline void Reserve(SizeType count)
+        {
+            Back.Reserve(count);
+            BlockEpochs.reserve(count / BlockSize + 1);
+        }
+
+        inline void Trim()
+        {
+            Back.Trim();
+        }
+
+        [[nodiscard]] inline std::size_t MemoryUsage() const
+        {
+            std::size_t usage = Back.MemoryUsage() + BlockEpochs.capacity() * sizeof(std::uint64_t);
+
+            for (const Buffer& buffer : Buffers)
+            {
+                usage += buffer.Dense.capacity() * sizeof(Type) + (buffer.Sparse.capacity() + buffer.ReverseMapping.capacity()) * sizeof(SizeType);
+            }
+
+            return usage;
+        }
+
+    private:
+        static constexpr std::uint8_t FreshFlag = 4;
+        static constexpr std::uint8_t IndexMask = 3;
+
+        inline void MarkDense(SizeType dense)
+        {
+            SizeType block = dense / BlockSize;
+
+            if (block >= BlockEpochs.size())
+            {
+                BlockEpochs.resize(block + 1, 0);
+            }
+
+            BlockEpochs[block] = Epoch;
+        }
+
+        inline void MarkStructure()
+        {
+            StructureEpoch = Epoch;
+        }
+
+        inline void MarkAll()
+        {
+            BlockEpochs.resize(Back.Size() / BlockSize + 1, 0);
+
+            ResetEpoch = Epoch;
+        }
+
+        BackType Back;
+
+        std::array<Buffer, 3> Buffers;
+        std::vector<std::uint64_t> BlockEpochs;
+
+        std::uint64_t Epoch = 1;
+        std::uint64_t StructureEpoch = 0;
+        std::uint64_t ResetEpoch = 0;
+
+        std::uint8_t WriteIndex = 0;
+        std::uint8_t ReadIndex = 1;
+
+        std::atomic<std::uint8_t> Ready = 2;
+    };
+}
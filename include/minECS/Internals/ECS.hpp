@@ -1,14 +1,39 @@
 #pragma once
 
 #include <minECS/Internals/BitsetTree.hpp>
+#include <minECS/Internals/CapacityProfile.hpp>
+#include <minECS/Internals/ComponentIndex.hpp>
+#include <minECS/Internals/DirectSet.hpp>
+#include <minECS/Internals/DoubleBufferedSet.hpp>
 #include <minECS/Internals/ECSDescriptor.hpp>
 #include <minECS/Internals/EntityView.hpp>
+#include <minECS/Internals/EventChannel.hpp>
+#include <minECS/Internals/Hierarchy.hpp>
+#include <minECS/Internals/HugePageAllocator.hpp>
+#include <minECS/Internals/IterationCursor.hpp>
+#include <minECS/Internals/Journal.hpp>
+#include <minECS/Internals/MappedVector.hpp>
+#include <minECS/Internals/PagedSet.hpp>
+#include <minECS/Internals/Profiler.hpp>
+#include <minECS/Internals/ReadSnapshot.hpp>
+#include <minECS/Internals/ResourceRegistry.hpp>
+#include <minECS/Internals/RollbackBuffer.hpp>
 #include <minECS/Internals/SparseSet.hpp>
+#include <minECS/Internals/SparseView.hpp>
+#include <minECS/Internals/StableSet.hpp>
 #include <minECS/Internals/Traits.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <bitset>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace minECS
@@ -21,20 +46,83 @@ namespace minECS
     class ECS<ECSDescriptor<TSizeType, TComponents...>>
     {
     public:
-        using BitsetType = std::bitset<sizeof...(TComponents)>;
         using SizeType = TSizeType;
         using DescriptorType = ECSDescriptor<TSizeType, TComponents...>;
+        using BitsetType = std::bitset<DescriptorType::ComponentCount>;
         using EntityType = Entity<SizeType>;
+#if defined(MINECS_ENABLE_HUGE_PAGES)
+        using ArchetypeType = SparseSet<EntityType, SizeType, HugePageVector<EntityType>, HugePageVector<SizeType>>;
+#else
         using ArchetypeType = SparseSet<EntityType, SizeType>;
+#endif
+        using ArchetypeTreeType = BitsetTree<ArchetypeType, SizeType, DescriptorType::ComponentCount>;
+        using JournalType = Journal<SizeType>;
+
+        struct EntityRecord
+        {
+            SizeType Archetype;
+            SizeType Row;
+        };
+
+        static constexpr SizeType NoArchetype = std::numeric_limits<SizeType>::max();
+
+        template <typename TComponent>
+        requires(DescriptorType::template Contains<TComponent>)
+        using StorageType = typename DescriptorType::template StorageType<TComponent>;
+
+        template <typename TDeclaration>
+        using StorageFor = ComponentStorageOf<TDeclaration, SizeType>;
+
+        template <typename TDeclaration>
+        using PrefabStorageFor = SparseSet<ComponentTypeOf<TDeclaration>, SizeType>;
+
+        template <typename TDeclaration>
+        using IndicesFor = std::vector<std::unique_ptr<ComponentIndex<ComponentTypeOf<TDeclaration>, SizeType>>>;
+
+        ECS()
+        {
+            RegisterArchetypes(std::make_index_sequence<DescriptorType::ArchetypeCount>{});
+        }
 
-        ECS() = default;
         ~ECS() = default;
 
         ECS(const ECS&) = delete;
-        ECS(ECS&&) noexcept = delete;
+
+        ECS(ECS&& other) noexcept
+            : SparseSets(std::move(other.SparseSets)), PrefabSets(std::move(other.PrefabSets)), Indices(std::move(other.Indices)), Archetypes(std::move(other.Archetypes)), DisabledRows(std::move(other.DisabledRows)), Records(std::move(other.Records)), Entities(std::move(other.Entities)), FreeList(std::move(other.FreeList)), PrefabMasks(std::move(other.PrefabMasks)), Resources(std::move(other.Resources)), EventUpdaters(std::move(other.EventUpdaters)), Relationships(std::move(other.Relationships)), EmptySince(std::move(other.EmptySince)), RetentionBudget(other.RetentionBudget), RetentionFrames(other.RetentionFrames), Frame(other.Frame), Log(std::exchange(other.Log, nullptr))
+        {
+            other.Clear();
+        }
 
         ECS& operator=(const ECS&) = delete;
-        ECS& operator=(ECS&&) noexcept = delete;
+
+        ECS& operator=(ECS&& other) noexcept
+        {
+            if (this != &other)
+            {
+                SparseSets = std::move(other.SparseSets);
+                PrefabSets = std::move(other.PrefabSets);
+                Indices = std::move(other.Indices);
+                Archetypes = std::move(other.Archetypes);
+                DisabledRows = std::move(other.DisabledRows);
+                Records = std::move(other.Records);
+                Entities = std::move(other.Entities);
+                FreeList = std::move(other.FreeList);
+                PrefabMasks = std::move(other.PrefabMasks);
+                Resources = std::move(other.Resources);
+                EventUpdaters = std::move(other.EventUpdaters);
+                Relationships = std::move(other.Relationships);
+                EmptySince = std::move(other.EmptySince);
+                RetentionBudget = other.RetentionBudget;
+                RetentionFrames = other.RetentionFrames;
+                Frame = other.Frame;
+                Log = std::exchange(other.Log, nullptr);
+
+                other.Clear();
+            }
+
+            return *this;
+        }
 
         [[nodiscard]] inline EntityType CreateBlankEntity()
         {
@@ -43,7 +131,9 @@ namespace minECS
                 SizeType size = Entities.size();
 
                 Entities.emplace_back(size, 0);
-                EntityMasks.emplace_back();
+                Records.push_back({NoArchetype, NoArchetype});
+
+                JournalEntity(JournalType::Operation::Create, Entities.back());
 
                 return Entities.back();
             }
@@ -51,11 +141,13 @@ namespace minECS
             {
                 SizeType index = FreeList.back();
                 EntityType& entity = Entities[index];
-                BitsetType& bitset = EntityMasks[index];
 
+                entity.GetID() = index;
                 entity.GetGeneration()++;
                 FreeList.pop_back();
-                bitset.reset();
+                Records[index] = {NoArchetype, NoArchetype};
+
+                JournalEntity(JournalType::Operation::Create, entity);
 
                 return entity;
             }
@@ -63,6 +155,8 @@ namespace minECS
 
         [[nodiscard]] inline std::vector<EntityType> CreateBlankEntities(SizeType count)
         {
+            MINECS_PROFILE_SCOPE("ECS::CreateBlankEntities");
+
             std::vector<EntityType> entities;
 
             entities.reserve(count);
@@ -81,26 +175,21 @@ namespace minECS
         requires((DescriptorType::template Contains<TQueried> && ...) && (sizeof...(TQueried) != 0))
         [[nodiscard]] inline ValueResult<EntityType> CreateEntity(TQueried&&... components)
         {
-            using ResultType1 = ReferenceResult<ArchetypeType>;
-            using ResultType2 = ReferenceResult<EntityType>;
+            constexpr std::size_t declaredIndex = DescriptorType::template ArchetypeIndex<TQueried...>();
 
             EntityType entity = CreateBlankEntity();
-            SizeType& id = entity.GetID();
-            BitsetType mask = MakeBitmask<TQueried...>();
-
-            EntityMasks[id] = mask;
+            SizeType archetypeIndex = 0;
 
-            ResultType1 result1 = Archetypes.Insert(mask);
-
-            if (result1.Failed())
+            if constexpr (declaredIndex < DescriptorType::ArchetypeCount)
             {
-                return ValueResult<EntityType>(entity, false);
+                archetypeIndex = static_cast<SizeType>(declaredIndex);
+            }
+            else
+            {
+                archetypeIndex = Archetypes.InsertIndex(MakeBitmask<TQueried...>()).GetValue();
             }
 
-            ArchetypeType& archetype = result1.GetValue();
-            ResultType2 result2 = archetype.Insert(id, entity);
-
-            if (result2.Failed())
+            if (!PlaceEntity(archetypeIndex, entity))
             {
                 return ValueResult<EntityType>(entity, false);
             }
@@ -114,6 +203,8 @@ namespace minECS
         requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
         inline std::vector<ValueResult<EntityType>> CreateEntities(SizeType count, TQueried&&... components)
         {
+            MINECS_PROFILE_SCOPE("ECS::CreateEntities");
+
             std::vector<ValueResult<EntityType>> entities;
 
             entities.reserve(count);
@@ -133,31 +224,19 @@ namespace minECS
                 SizeType& id = entity.GetID();
                 SizeType& generation = entity.GetGeneration();
 
-                const BitsetType& bitset = EntityMasks[id];
-                ReferenceResult<ArchetypeType> archetypeResult = Archetypes.Get(bitset);
-
-                if (!archetypeResult.Failed())
+                if (Records[id].Archetype != NoArchetype)
                 {
-                    RemoveEntityFromSparseSets(entity, bitset);
+                    RemoveEntityFromSparseSets(entity, GetMask(id));
 
-                    auto& archetype = archetypeResult.GetValue();
-                    auto& entities = archetype->GetEntities();
-                    auto& dense = entities.GetDense();
+                    ReleaseArchetype(DisplaceEntity(id));
+                }
 
-                    if (!archetype->Remove(id))
-                    {
-                        return false;
-                    }
+                Relationships.Remove(id);
 
-                    if (dense.size() == 0)
-                    {
-                        Archetypes.Remove(bitset);
-                    }
-                }
+                JournalEntity(JournalType::Operation::Destroy, entity);
 
                 FreeList.push_back(id);
                 Entities[id] = {std::numeric_limits<SizeType>::max(), generation};
-                EntityMasks[id].reset();
             }
             else
             {
@@ -169,6 +248,8 @@ namespace minECS
 
         [[nodiscard]] inline bool DestroyEntities(const std::vector<EntityType>& entities)
         {
+            MINECS_PROFILE_SCOPE("ECS::DestroyEntities");
+
             bool result = true;
 
             for (const auto& entity : entities)
@@ -200,6 +281,54 @@ namespace minECS
             return true;
         }
 
+        [[nodiscard]] inline ValueResult<EntityRecord> GetEntityRecord(EntityType entity) const
+        {
+            if (!HasEntity(entity))
+            {
+                return ValueResult<EntityRecord>({NoArchetype, NoArchetype}, false);
+            }
+
+            return ValueResult<EntityRecord>(Records[entity.GetID()], true);
+        }
+
+        [[nodiscard]] inline bool SetEntityEnabled(EntityType entity, bool enabled)
+        {
+            if (!HasEntity(entity))
+            {
+                return false;
+            }
+
+            const EntityRecord& record = Records[entity.GetID()];
+
+            if (record.Archetype == NoArchetype)
+            {
+                std::cerr << "Failed to toggle entity " << entity.GetID() << ": entity has no components\n";
+
+                return false;
+            }
+
+            SetRowEnabled(record, enabled);
+
+            return true;
+        }
+
+        [[nodiscard]] inline bool SetEntitiesEnabled(const std::vector<EntityType>& entities, bool enabled)
+        {
+            bool result = true;
+
+            for (const auto& entity : entities)
+            {
+                result &= SetEntityEnabled(entity, enabled);
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] inline bool IsEntityEnabled(EntityType entity) const
+        {
+            return HasEntity(entity) && IsRowEnabled(Records[entity.GetID()]);
+        }
+
         template <typename U>
         requires(DescriptorType::template Contains<U>)
         [[nodiscard]] inline bool EntityHasComponent(EntityType entity) const
@@ -210,7 +339,7 @@ namespace minECS
             {
                 constexpr SizeType index = DescriptorType::template Index<U>();
 
-                return EntityMasks[id].test(index);
+                return GetMask(id).test(index);
             }
 
             return false;
@@ -261,16 +390,16 @@ namespace minECS
             {
                 SizeType& id = entity.GetID();
 
-                auto& set = std::get<SparseSet<TComponent, SizeType>>(SparseSets);
+                auto& set = GetSparseSet<TComponent>();
 
                 constexpr SizeType index = DescriptorType::template Index<TComponent>();
 
-                BitsetType& targetBitset = EntityMasks[id];
-                BitsetType oldBitset = EntityMasks[id];
+                BitsetType oldBitset = GetMask(id);
+                BitsetType newBitset = oldBitset;
 
-                targetBitset.set(index);
+                newBitset.set(index);
 
-                bool archetypeResult = UpdateArchetype(entity, oldBitset, targetBitset);
+                bool archetypeResult = UpdateArchetype(entity, oldBitset, newBitset);
 
                 if (archetypeResult)
                 {
@@ -280,6 +409,8 @@ namespace minECS
                     {
                         return false;
                     }
+
+                    ComponentInserted<index>(entity);
                 }
 
                 return archetypeResult;
@@ -294,32 +425,63 @@ namespace minECS
         requires(DescriptorType::template Contains<TComponent>)
         [[nodiscard]] inline bool AddComponentToEntities(const std::vector<EntityType>& entities, TComponent&& component)
         {
-            bool result = true;
-
-            for (auto& entity : entities)
-            {
-                result &= AddComponentToEntity(entity, std::forward<TComponent>(component));
-            }
-
-            return result;
+            return AddComponentsToEntities<TComponent>(entities, std::forward<TComponent>(component));
         }
 
         template <typename... TQueried>
         requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
         [[nodiscard]] inline bool AddComponentsToEntity(EntityType entity, TQueried&&... components)
         {
-            return (AddComponentToEntity<TQueried>(entity, std::forward<TQueried>(components)) && ...);
+            const BitsetType added = MakeBitmask<TQueried...>();
+
+            if (!HasEntity(entity) || (GetMask(entity.GetID()) & added).any())
+            {
+                return (AddComponentToEntity<TQueried>(entity, std::forward<TQueried>(components)) && ...);
+            }
+
+            BitsetType oldBitset = GetMask(entity.GetID());
+            BitsetType newBitset = oldBitset | added;
+
+            if (!UpdateArchetype(entity, oldBitset, newBitset))
+            {
+                return false;
+            }
+
+            return (AddEntityToSparseSet<TQueried>(entity, std::forward<TQueried>(components)) && ...);
         }
 
         template <typename... TQueried>
         requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
         [[nodiscard]] inline bool AddComponentsToEntities(const std::vector<EntityType>& entities, TQueried&&... components)
         {
+            MINECS_PROFILE_SCOPE("ECS::AddComponentsToEntities");
+
+            const BitsetType added = MakeBitmask<TQueried...>();
+
+            std::vector<EntityType> batch;
             bool result = true;
 
-            for (auto& entity : entities)
+            batch.reserve(entities.size());
+
+            for (const auto& entity : entities)
+            {
+                if (HasEntity(entity) && (GetMask(entity.GetID()) & added).none())
+                {
+                    batch.push_back(entity);
+                }
+                else
+                {
+                    result &= AddComponentsToEntity<TQueried...>(entity, TQueried(components)...);
+                }
+            }
+
+            MigrateEntities(batch, added, true);
+
+            (GetSparseSet<TQueried>().Reserve(GetSparseSet<TQueried>().Size() + static_cast<SizeType>(batch.size())), ...);
+
+            for (auto& entity : batch)
             {
-                result &= AddComponentsToEntity<TQueried...>(entity, std::forward<TQueried>(components)...);
+                result &= (AddEntityToSparseSet<TQueried>(entity, components) && ...);
             }
 
             return result;
@@ -331,22 +493,20 @@ namespace minECS
         {
             if (HasEntity(entity))
             {
-                auto& set = std::get<SparseSet<TComponent, SizeType>>(SparseSets);
-
                 SizeType& id = entity.GetID();
 
                 constexpr SizeType index = DescriptorType::template Index<TComponent>();
 
-                BitsetType& targetBitset = EntityMasks[id];
-                BitsetType oldBitset = EntityMasks[id];
+                BitsetType oldBitset = GetMask(id);
+                BitsetType newBitset = oldBitset;
 
-                targetBitset.reset(index);
+                newBitset.reset(index);
 
-                bool archetypeResult = UpdateArchetype(entity, oldBitset, targetBitset);
+                bool archetypeResult = UpdateArchetype(entity, oldBitset, newBitset);
 
                 if (archetypeResult)
                 {
-                    set.Remove(id);
+                    RemoveComponentAt<index>(entity);
                 }
 
                 return archetypeResult;
@@ -361,179 +521,1957 @@ namespace minECS
         requires(DescriptorType::template Contains<TComponent>)
         [[nodiscard]] inline bool RemoveComponentFromEntities(const std::vector<EntityType>& entities)
         {
-            bool result = true;
-
-            for (auto& entity : entities)
-            {
-                result &= RemoveComponentFromEntity<TComponent>(entity);
-            }
-
-            return result;
+            return RemoveComponentsFromEntity<TComponent>(entities);
         }
 
         template <typename... TQueried>
         requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
         [[nodiscard]] inline bool RemoveComponentsFromEntity(EntityType entity)
         {
-            return (RemoveComponentFromEntity<TQueried>(entity) && ...);
+            const BitsetType removed = MakeBitmask<TQueried...>();
+
+            if (!HasEntity(entity) || (GetMask(entity.GetID()) & removed) != removed)
+            {
+                return (RemoveComponentFromEntity<TQueried>(entity) && ...);
+            }
+
+            BitsetType oldBitset = GetMask(entity.GetID());
+            BitsetType newBitset = oldBitset & ~removed;
+
+            if (!UpdateArchetype(entity, oldBitset, newBitset))
+            {
+                return false;
+            }
+
+            (RemoveComponentAt<DescriptorType::template Index<TQueried>()>(entity), ...);
+
+            return true;
         }
 
         template <typename... TQueried>
         requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
         [[nodiscard]] inline bool RemoveComponentsFromEntity(const std::vector<EntityType>& entities)
         {
-            bool ReferenceResult = true;
+            MINECS_PROFILE_SCOPE("ECS::RemoveComponentsFromEntities");
+
+            const BitsetType removed = MakeBitmask<TQueried...>();
+
+            std::vector<EntityType> batch;
+            bool result = true;
+
+            batch.reserve(entities.size());
+
+            for (const auto& entity : entities)
+            {
+                if (HasEntity(entity) && (GetMask(entity.GetID()) & removed) == removed)
+                {
+                    batch.push_back(entity);
+                }
+                else
+                {
+                    result &= RemoveComponentsFromEntity<TQueried...>(entity);
+                }
+            }
+
+            MigrateEntities(batch, removed, false);
+
+            for (const auto& entity : batch)
+            {
+                (RemoveComponentAt<DescriptorType::template Index<TQueried>()>(entity), ...);
+            }
+
+            return result;
+        }
+
+        template <typename TComponent, typename TFunction>
+        requires(DescriptorType::template Contains<TComponent>)
+        [[nodiscard]] inline bool PatchComponent(EntityType entity, TFunction&& function)
+        {
+            if (!HasEntity(entity))
+            {
+                return false;
+            }
 
-            for (auto& entity : entities)
+            ReferenceResult<TComponent> result = GetSparseSet<TComponent>().Get(entity.GetID());
+
+            if (result.Failed())
             {
-                ReferenceResult &= RemoveComponentsFromEntity<TQueried...>(entity);
+                return false;
             }
 
-            return ReferenceResult;
+            std::forward<TFunction>(function)(result.GetValue());
+
+            ComponentUpdated<DescriptorType::template Index<TComponent>()>(entity, result.GetValue());
+
+            return true;
         }
 
-        [[nodiscard]] inline BitsetTree<ArchetypeType, SizeType, sizeof...(TComponents)>& GetArchetypess()
+        template <typename TComponent>
+        requires(DescriptorType::template Contains<TComponent>)
+        [[nodiscard]] inline bool SetComponent(EntityType entity, TComponent&& component)
         {
-            return Archetypes;
+            return PatchComponent<TComponent>(entity, [&component](TComponent& target)
+            {
+                target = std::forward<TComponent>(component);
+            });
         }
 
-        [[nodiscard]] inline const BitsetTree<ArchetypeType, SizeType, sizeof...(TComponents)>& GetArchetypes() const
+        template <typename TComponent, typename TKeyFunction>
+        requires(DescriptorType::template Contains<TComponent>)
+        inline HashIndex<TComponent, SizeType, TKeyFunction>& CreateHashIndex(TKeyFunction keyFunction)
         {
-            return Archetypes;
+            return AddIndex(std::make_unique<HashIndex<TComponent, SizeType, TKeyFunction>>(std::move(keyFunction)));
         }
 
-        [[nodiscard]] ReferenceResult<ArchetypeType> GetArchetype(const BitsetType& mask)
+        template <typename TComponent, typename TKeyFunction>
+        requires(DescriptorType::template Contains<TComponent>)
+        inline OrderedIndex<TComponent, SizeType, TKeyFunction>& CreateOrderedIndex(TKeyFunction keyFunction)
         {
-            return Archetypes.Get(mask);
+            return AddIndex(std::make_unique<OrderedIndex<TComponent, SizeType, TKeyFunction>>(std::move(keyFunction)));
         }
 
-        [[nodiscard]] const ReferenceResult<ArchetypeType> GetArchetype(const BitsetType& mask) const
+        inline void CompactStorage()
         {
-            return Archetypes.Get(mask);
+            MINECS_PROFILE_SCOPE("ECS::CompactStorage");
+
+            CompactStorageImplementation(std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            for (SizeType index = 0; index < Archetypes.Size(); index++)
+            {
+                if (Archetypes.IsAlive(index))
+                {
+                    Archetypes.At(index).second.Trim();
+                }
+            }
+
+            CompactArchetypes();
+        }
+
+        inline void SwapBuffers()
+        {
+            MINECS_PROFILE_SCOPE("ECS::SwapBuffers");
+
+            SwapBuffersImplementation(std::make_index_sequence<DescriptorType::ComponentCount>{});
         }
 
         template <typename TComponent>
-        requires(DescriptorType::template Contains<TComponent>)
-        [[nodiscard]] inline constexpr SparseSet<TComponent, SizeType>& GetSparseSet()
+        requires(DescriptorType::template Contains<TComponent> && IsDoubleBufferedSet<StorageType<TComponent>>)
+        [[nodiscard]] inline auto GetFrontBuffer()
+        {
+            return GetSparseSet<TComponent>().AcquireFront();
+        }
+
+        inline void ReserveEntities(SizeType count)
         {
-            return std::get<SparseSet<TComponent, SizeType>>(SparseSets);
+            Entities.reserve(count);
+            Records.reserve(count);
+            FreeList.reserve(count);
+
+            ReserveStorages(0, std::make_index_sequence<DescriptorType::ComponentCount>{});
         }
 
         template <typename TComponent>
         requires(DescriptorType::template Contains<TComponent>)
-        [[nodiscard]] inline constexpr const SparseSet<TComponent, SizeType>& GetSparseSet() const
+        inline void ReserveComponent(SizeType count)
         {
-            return std::get<SparseSet<TComponent, SizeType>>(SparseSets);
+            ReserveStorage<DescriptorType::template Index<TComponent>()>(count);
         }
 
         template <typename... TQueried>
         requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
-        [[nodiscard]] static inline constexpr BitsetType MakeBitmask()
+        inline void ReserveArchetype(SizeType count)
         {
-            BitsetType bitset;
-
-            (bitset.set(DescriptorType::template Index<TQueried>()), ...);
-
-            return bitset;
+            ReserveArchetype(MakeBitmask<TQueried...>(), count);
         }
 
-        template <typename... TQueried>
-        requires(DescriptorType::template Contains<TQueried> && ...)
-        [[nodiscard]] inline auto GetEntityView(ArchetypeType& archetype)
+        inline void ReserveArchetype(const BitsetType& mask, SizeType count)
         {
-            return EntityView<ECS<DescriptorType>, SizeType, TQueried...>(this, archetype);
+            SizeType index = Archetypes.InsertIndex(mask).GetValue();
+
+            Archetypes.At(index).second.Reserve(count);
+            Archetypes.Pin(mask);
         }
 
         template <typename... TQueried>
-        requires(DescriptorType::template Contains<TQueried> && ...)
-        [[nodiscard]] inline const auto GetEntityView(ArchetypeType& archetype) const
+        requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
+        inline void UnreserveArchetype()
         {
-            return EntityView<ECS<DescriptorType>, SizeType, TQueried...>(this, archetype);
+            UnreserveArchetype(MakeBitmask<TQueried...>());
         }
 
-    private:
-        [[nodiscard]] inline bool UpdateArchetype(EntityType entity, const BitsetType& oldBitset, const BitsetType& newBitset)
+        inline void UnreserveArchetype(const BitsetType& mask)
         {
-            using ResultType = ReferenceResult<ArchetypeType>;
+            ValueResult<SizeType> index = Archetypes.Find(mask);
 
-            if (oldBitset == newBitset)
+            if (!index.Succeeded() || index.GetValue() < DescriptorType::ArchetypeCount)
             {
-                std::cerr << "Failed to insert entity " << entity.GetID() << " into archetype: same bitset\n";
-
-                return false;
+                return;
             }
 
-            ResultType result = Archetypes.Get(oldBitset);
+            Archetypes.Unpin(mask);
 
-            if (!result.Failed())
-            {
-                ArchetypeType& oldArchetype = result.GetValue();
+            ReleaseArchetype(index.GetValue());
+        }
 
-                if (!oldArchetype.Remove(entity.GetID()))
-                {
-                    std::cerr << "Failed to remove entity " << entity.GetID() << " from old archetype\n";
+        inline void SampleCapacity(CapacityProfile& profile) const
+        {
+            profile.RecordEntities(Entities.size());
+            profile.RecordNodes(Archetypes.GetNodeCapacity());
 
-                    return false;
-                }
+            SampleComponentCapacity(profile, std::make_index_sequence<DescriptorType::ComponentCount>{});
 
-                auto& dense = oldArchetype.GetDense();
+            for (SizeType index = 0; index < Archetypes.Size(); index++)
+            {
+                const auto& [mask, archetype] = Archetypes.At(index);
 
-                if (dense.size() == 0)
+                if (Archetypes.IsAlive(index) && !archetype.Empty())
                 {
-                    Archetypes.Remove(oldBitset);
+                    profile.RecordArchetype(mask.to_string(), archetype.Size());
                 }
             }
+        }
 
-            ResultType insertResult = Archetypes.Insert(newBitset);
+        inline void ApplyCapacity(const CapacityProfile& profile)
+        {
+            MINECS_PROFILE_SCOPE("ECS::ApplyCapacity");
 
-            if (insertResult.Failed())
-            {
-                std::cerr << "Failed to insert new archetype\n";
+            const auto& archetypes = profile.GetArchetypes();
 
-                return false;
-            }
+            ReserveEntities(static_cast<SizeType>(profile.GetEntities()));
+            ApplyComponentCapacity(profile, std::make_index_sequence<DescriptorType::ComponentCount>{});
 
-            auto& archetype = insertResult.GetValue();
-            auto& id = entity.GetID();
-            auto archetypeInsertResult = archetype.Insert(id, entity);
+            Archetypes.Reserve(static_cast<SizeType>(Archetypes.Size() + archetypes.size()), static_cast<SizeType>(profile.GetNodes()));
 
-            if (archetypeInsertResult.Failed())
+            for (const auto& [mask, count] : archetypes)
             {
-                std::cerr << "Failed to add entity " << entity.GetID() << " to new archetype\n";
-            }
+                if (mask.size() != DescriptorType::ComponentCount)
+                {
+                    std::cerr << "Skipping archetype " << mask << " from capacity profile: component count mismatch\n";
 
-            return !archetypeInsertResult.Failed();
-        }
+                    continue;
+                }
 
-        template <std::size_t... Ns>
-        inline void RemoveEntityFromSparseSetsImplementation(EntityType entity, const BitsetType& mask, std::index_sequence<Ns...>)
-        {
-            ((mask.test(Ns) ? std::get<Ns>(SparseSets).Remove(entity.GetID()) : void()), ...);
+                ReserveArchetype(BitsetType(mask), static_cast<SizeType>(count));
+            }
         }
 
-        inline void RemoveEntityFromSparseSets(EntityType entity, const BitsetType& mask)
+        inline void SetArchetypeRetention(SizeType frames, std::size_t memoryBudget = std::numeric_limits<std::size_t>::max())
         {
-            RemoveEntityFromSparseSetsImplementation(entity, mask, std::index_sequence_for<TComponents...>{});
+            RetentionFrames = frames;
+            RetentionBudget = memoryBudget;
         }
 
-        template <typename T, typename U>
-        inline bool AddEntityToSparseSet(EntityType& entity, U&& component)
+        inline void CollectGarbage()
         {
-            using SparseSetType = SparseSet<T, SizeType>;
-            using ResultType = ReferenceResult<typename SparseSetType::Type>;
+            MINECS_PROFILE_SCOPE("ECS::CollectGarbage");
 
-            SparseSetType& sparseSet = std::get<SparseSetType>(SparseSets);
-            ResultType result = sparseSet.Insert(entity.GetID(), std::forward<U>(component));
+            Frame++;
+
+            std::vector<SizeType> retained;
+            std::size_t retainedMemory = 0;
+
+            for (SizeType index = DescriptorType::ArchetypeCount; index < Archetypes.Size(); index++)
+            {
+                if (!Archetypes.IsAlive(index))
+                {
+                    continue;
+                }
+
+                auto& [mask, archetype] = Archetypes.At(index);
+
+                if (!archetype.Empty() || Archetypes.IsPinned(mask))
+                {
+                    continue;
+                }
+
+                if (index >= EmptySince.size() || Frame - EmptySince[index] >= RetentionFrames)
+                {
+                    Archetypes.Remove(mask);
+
+                    continue;
+                }
+
+                retained.push_back(index);
+                retainedMemory += archetype.MemoryUsage();
+            }
+
+            if (retainedMemory > RetentionBudget)
+            {
+                std::sort(retained.begin(), retained.end(), [&](SizeType left, SizeType right)
+                {
+                    return EmptySince[left] < EmptySince[right];
+                });
+
+                for (SizeType index : retained)
+                {
+                    if (retainedMemory <= RetentionBudget)
+                    {
+                        break;
+                    }
+
+                    auto& [mask, archetype] = Archetypes.At(index);
+
+                    retainedMemory -= archetype.MemoryUsage();
+
+                    Archetypes.Remove(mask);
+                }
+            }
 
-            return !result.Failed();
+            if (Archetypes.GetDeadCount() > MinimumDeadArchetypes && Archetypes.GetDeadCount() * 2 > Archetypes.Size())
+            {
+                CompactArchetypes();
+            }
         }
 
-        std::tuple<SparseSet<TComponents, SizeType>...> SparseSets;
+        inline void CompactArchetypes()
+        {
+            MINECS_PROFILE_SCOPE("ECS::CompactArchetypes");
+
+            if (Archetypes.GetDeadCount() == 0)
+            {
+                return;
+            }
 
-        BitsetTree<ArchetypeType, SizeType, sizeof...(TComponents)> Archetypes;
+            std::vector<SizeType> remap = Archetypes.Compact();
+            std::vector<SizeType> emptySince(Archetypes.Size(), Frame);
 
-        std::vector<BitsetType> EntityMasks;
-        std::vector<EntityType> Entities;
-        std::vector<SizeType> FreeList;
+            for (SizeType index = 0; index < EmptySince.size() && index < remap.size(); index++)
+            {
+                if (remap[index] != ArchetypeTreeType::DeadIndex)
+                {
+                    emptySince[remap[index]] = EmptySince[index];
+                }
+            }
+
+            EmptySince = std::move(emptySince);
+
+            std::vector<RowMask> disabledRows(Archetypes.Size());
+
+            for (SizeType index = 0; index < DisabledRows.size() && index < remap.size(); index++)
+            {
+                if (remap[index] != ArchetypeTreeType::DeadIndex)
+                {
+                    disabledRows[remap[index]] = std::move(DisabledRows[index]);
+                }
+            }
+
+            DisabledRows = std::move(disabledRows);
+
+            for (EntityRecord& record : Records)
+            {
+                if (record.Archetype != NoArchetype)
+                {
+                    record.Archetype = remap[record.Archetype];
+                }
+            }
+        }
+
+        [[nodiscard]] inline SizeType GetFrame() const
+        {
+            return Frame;
+        }
+
+        inline void AttachJournal(JournalType& journal)
+        requires(std::is_trivially_copyable_v<ComponentTypeOf<TComponents>> && ...)
+        {
+            Log = &journal;
+        }
+
+        inline void DetachJournal()
+        {
+            if (Log)
+            {
+                Log->Flush();
+            }
+
+            Log = nullptr;
+        }
+
+        [[nodiscard]] inline bool WriteSnapshot(const std::string& path) const
+        requires(std::is_trivially_copyable_v<ComponentTypeOf<TComponents>> && ...)
+        {
+            MINECS_PROFILE_SCOPE("ECS::WriteSnapshot");
+
+            JournalType journal;
+
+            if (!journal.Open(path))
+            {
+                return false;
+            }
+
+            journal.Append(JournalType::Operation::Reserve, 0, static_cast<SizeType>(Entities.size()), 0);
+
+            for (const EntityType& entity : Entities)
+            {
+                if (entity.GetID() != std::numeric_limits<SizeType>::max())
+                {
+                    journal.Append(JournalType::Operation::Create, 0, entity.GetID(), entity.GetGeneration());
+                }
+            }
+
+            SnapshotComponents(journal, std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            for (const SizeType& id : FreeList)
+            {
+                journal.Append(JournalType::Operation::Free, 0, id, Entities[id].GetGeneration());
+            }
+
+            journal.Close();
+
+            return true;
+        }
+
+        [[nodiscard]] inline bool Replay(const std::string& path)
+        requires(std::is_trivially_copyable_v<ComponentTypeOf<TComponents>> && ...)
+        {
+            MINECS_PROFILE_SCOPE("ECS::Replay");
+
+            JournalType* log = std::exchange(Log, nullptr);
+
+            bool result = JournalType::Read(path, [this](const typename JournalType::Record& record, const std::byte* payload)
+            {
+                ApplyRecord(record, payload);
+            });
+
+            Log = log;
+
+            return result;
+        }
+
+        [[nodiscard]] inline bool Restore(const std::string& snapshot, const std::string& journal)
+        requires(std::is_trivially_copyable_v<ComponentTypeOf<TComponents>> && ...)
+        {
+            JournalType* log = std::exchange(Log, nullptr);
+
+            Clear();
+
+            Log = log;
+
+            return Replay(snapshot) && Replay(journal);
+        }
+
+        inline void SaveRollback(RollbackBuffer& buffer, std::uint64_t tick) const
+        requires(std::is_trivially_copyable_v<ComponentTypeOf<TComponents>> && ...)
+        {
+            MINECS_PROFILE_SCOPE("ECS::SaveRollback");
+
+            std::vector<BitsetType> masks;
+            std::vector<std::uint8_t> flags;
+            std::vector<SizeType> disabledCounts;
+
+            masks.reserve(Archetypes.Size());
+            flags.reserve(Archetypes.Size());
+            disabledCounts.reserve(DisabledRows.size());
+
+            for (SizeType index = 0; index < Archetypes.Size(); index++)
+            {
+                const BitsetType& mask = Archetypes.At(index).first;
+                bool alive = Archetypes.IsAlive(index);
+
+                masks.push_back(mask);
+                flags.push_back(static_cast<std::uint8_t>((alive ? AliveArchetype : 0) | (alive && Archetypes.IsPinned(mask) ? PinnedArchetype : 0)));
+            }
+
+            for (const RowMask& rows : DisabledRows)
+            {
+                disabledCounts.push_back(rows.Count);
+            }
+
+            buffer.BeginCapture(tick);
+
+            buffer.Capture(Entities);
+            buffer.Capture(FreeList);
+            buffer.Capture(Records);
+            buffer.Capture(masks);
+            buffer.Capture(flags);
+
+            for (SizeType index = 0; index < Archetypes.Size(); index++)
+            {
+                const ArchetypeType& archetype = Archetypes.At(index).second;
+
+                buffer.Capture(archetype.GetDense());
+                buffer.Capture(archetype.GetSparse());
+                buffer.Capture(archetype.GetReverseMapping());
+            }
+
+            buffer.Capture(EmptySince);
+            buffer.CaptureValue(Frame);
+            buffer.Capture(disabledCounts);
+
+            for (const RowMask& rows : DisabledRows)
+            {
+                buffer.Capture(rows.Words);
+            }
+
+            SaveRollbackComponents(buffer, std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            const auto& relationships = Relationships.GetRelationships();
+
+            buffer.Capture(relationships.GetDense());
+            buffer.Capture(relationships.GetSparse());
+            buffer.Capture(relationships.GetReverseMapping());
+
+            buffer.EndCapture();
+        }
+
+        [[nodiscard]] inline bool LoadRollback(RollbackBuffer& buffer, std::uint64_t tick)
+        requires(std::is_trivially_copyable_v<ComponentTypeOf<TComponents>> && ...)
+        {
+            MINECS_PROFILE_SCOPE("ECS::LoadRollback");
+
+            if (!buffer.BeginRestore(tick))
+            {
+                return false;
+            }
+
+            buffer.Restore(Entities);
+            buffer.Restore(FreeList);
+            buffer.Restore(Records);
+
+            std::vector<BitsetType> masks;
+            std::vector<std::uint8_t> flags;
+
+            buffer.Restore(masks);
+            buffer.Restore(flags);
+
+            if (!MatchesArchetypeLayout(masks, flags))
+            {
+                Archetypes = ArchetypeTreeType();
+
+                for (SizeType index = 0; index < masks.size(); index++)
+                {
+                    static_cast<void>(Archetypes.InsertIndex(masks[index]));
+
+                    if (flags[index] & PinnedArchetype)
+                    {
+                        Archetypes.Pin(masks[index]);
+                    }
+
+                    if (!(flags[index] & AliveArchetype))
+                    {
+                        Archetypes.Remove(masks[index]);
+                    }
+                }
+            }
+
+            for (SizeType index = 0; index < Archetypes.Size(); index++)
+            {
+                ArchetypeType& archetype = Archetypes.At(index).second;
+
+                buffer.Restore(archetype.GetDense());
+                buffer.Restore(archetype.GetSparse());
+                buffer.Restore(archetype.GetReverseMapping());
+            }
+
+            buffer.Restore(EmptySince);
+
+            Frame = buffer.RestoreValue<SizeType>();
+
+            std::vector<SizeType> disabledCounts;
+
+            buffer.Restore(disabledCounts);
+
+            DisabledRows.resize(disabledCounts.size());
+
+            for (SizeType index = 0; index < DisabledRows.size(); index++)
+            {
+                DisabledRows[index].Count = disabledCounts[index];
+
+                buffer.Restore(DisabledRows[index].Words);
+            }
+
+            LoadRollbackComponents(buffer, std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            SparseSet<typename Hierarchy<SizeType>::Relationship, SizeType> relationships;
+
+            buffer.Restore(relationships.GetDense());
+            buffer.Restore(relationships.GetSparse());
+            buffer.Restore(relationships.GetReverseMapping());
+
+            Relationships.Assign(std::move(relationships));
+
+            return true;
+        }
+
+        inline void Clear()
+        {
+            if (Log)
+            {
+                Log->Append(JournalType::Operation::Clear, 0, 0, 0);
+            }
+
+            ClearSparseSets(std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            Archetypes = ArchetypeTreeType();
+
+            RegisterArchetypes(std::make_index_sequence<DescriptorType::ArchetypeCount>{});
+
+            Relationships.Clear();
+            EmptySince.clear();
+            DisabledRows.clear();
+            Records.clear();
+            Entities.clear();
+            FreeList.clear();
+        }
+
+        [[nodiscard]] inline std::vector<EntityType> MergeFrom(ECS& other)
+        {
+            MINECS_PROFILE_SCOPE("ECS::MergeFrom");
+
+            std::vector<EntityType> remap(other.Entities.size(), EntityType(std::numeric_limits<SizeType>::max(), 0));
+
+            if (&other == this)
+            {
+                return remap;
+            }
+
+            Entities.reserve(Entities.size() + other.Entities.size() - other.FreeList.size());
+            Records.reserve(Records.size() + other.Entities.size() - other.FreeList.size());
+
+            for (const auto& entity : other.Entities)
+            {
+                const SizeType& id = entity.GetID();
+
+                if (id == std::numeric_limits<SizeType>::max())
+                {
+                    continue;
+                }
+
+                remap[id] = CreateBlankEntity();
+            }
+
+            for (auto& [mask, otherArchetype] : other.Archetypes)
+            {
+                if (otherArchetype.Empty())
+                {
+                    continue;
+                }
+
+                SizeType archetypeIndex = Archetypes.InsertIndex(mask).GetValue();
+                ArchetypeType& archetype = Archetypes.At(archetypeIndex).second;
+
+                archetype.Reserve(archetype.Size() + otherArchetype.Size());
+
+                for (const auto& entity : otherArchetype)
+                {
+                    static_cast<void>(PlaceEntity(archetypeIndex, remap[entity.GetID()], other.IsRowEnabled(other.Records[entity.GetID()])));
+                }
+            }
+
+            MergeSparseSets(other, remap, std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            const auto& relationships = other.Relationships.GetRelationships();
+
+            for (SizeType i = 0; i < relationships.Size(); i++)
+            {
+                SizeType parent = relationships.GetDense()[i].Parent;
+
+                if (parent != Hierarchy<SizeType>::DeadIndex)
+                {
+                    static_cast<void>(Relationships.SetParent(remap[relationships.GetReverseMapping()[i]].GetID(), remap[parent].GetID()));
+                }
+            }
+
+            other.Clear();
+
+            return remap;
+        }
+
+        [[nodiscard]] inline std::vector<EntityType> MoveEntities(const BitsetType& mask, ECS& other)
+        {
+            MINECS_PROFILE_SCOPE("ECS::MoveEntities");
+
+            std::vector<EntityType> remap(other.Entities.size(), EntityType(std::numeric_limits<SizeType>::max(), 0));
+
+            if (&other == this)
+            {
+                return remap;
+            }
+
+            std::vector<std::pair<SizeType, SizeType>> parents;
+
+            for (const auto& [otherMask, otherArchetype] : other.Archetypes)
+            {
+                if ((otherMask & mask) != mask)
+                {
+                    continue;
+                }
+
+                for (const auto& entity : otherArchetype)
+                {
+                    SizeType parent = other.Relationships.GetParentIndex(entity.GetID());
+
+                    if (parent != Hierarchy<SizeType>::DeadIndex)
+                    {
+                        parents.emplace_back(entity.GetID(), parent);
+                    }
+                }
+            }
+
+            for (SizeType otherIndex = 0; otherIndex < other.Archetypes.Size(); otherIndex++)
+            {
+                auto& [otherMask, otherArchetype] = other.Archetypes.At(otherIndex);
+
+                if (!other.Archetypes.IsAlive(otherIndex) || otherArchetype.Empty() || (otherMask & mask) != mask)
+                {
+                    continue;
+                }
+
+                SizeType archetypeIndex = Archetypes.InsertIndex(otherMask).GetValue();
+                ArchetypeType& archetype = Archetypes.At(archetypeIndex).second;
+
+                archetype.Reserve(archetype.Size() + otherArchetype.Size());
+
+                for (const auto& entity : otherArchetype)
+                {
+                    const SizeType& id = entity.GetID();
+                    EntityType newEntity = CreateBlankEntity();
+
+                    remap[id] = newEntity;
+
+                    static_cast<void>(PlaceEntity(archetypeIndex, newEntity, other.IsRowEnabled(other.Records[id])));
+
+                    MoveEntityComponents(other, id, newEntity.GetID(), otherMask, std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+                    other.Relationships.Remove(id);
+                    other.JournalEntity(JournalType::Operation::Destroy, entity);
+
+                    other.FreeList.push_back(id);
+                    other.Entities[id] = {std::numeric_limits<SizeType>::max(), entity.GetGeneration()};
+                    other.Records[id] = {NoArchetype, NoArchetype};
+                }
+
+                otherArchetype.Clear();
+
+                if (otherIndex < other.DisabledRows.size())
+                {
+                    other.DisabledRows[otherIndex] = RowMask();
+                }
+
+                other.ReleaseArchetype(otherIndex);
+            }
+
+            for (const auto& [child, parent] : parents)
+            {
+                if (remap[parent].GetID() != std::numeric_limits<SizeType>::max())
+                {
+                    static_cast<void>(Relationships.SetParent(remap[child].GetID(), remap[parent].GetID()));
+                }
+            }
+
+            return remap;
+        }
+
+        template <typename... TQueried>
+        requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
+        [[nodiscard]] inline SizeType CreatePrefab(TQueried&&... components)
+        {
+            SizeType prefab = PrefabMasks.size();
+
+            PrefabMasks.push_back(MakeBitmask<TQueried...>());
+
+            (static_cast<void>(std::get<DescriptorType::template Index<TQueried>()>(PrefabSets).Insert(prefab, std::forward<TQueried>(components))), ...);
+
+            return prefab;
+        }
+
+        [[nodiscard]] inline ValueResult<SizeType> CreatePrefabFromEntity(EntityType entity)
+        {
+            if (!HasEntity(entity))
+            {
+                return ValueResult<SizeType>(std::numeric_limits<SizeType>::max(), false);
+            }
+
+            SizeType prefab = PrefabMasks.size();
+            const BitsetType& mask = GetMask(entity.GetID());
+
+            PrefabMasks.push_back(mask);
+
+            CopyPrefabComponents(entity.GetID(), prefab, mask, std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            return ValueResult<SizeType>(prefab, true);
+        }
+
+        [[nodiscard]] inline bool HasPrefab(SizeType prefab) const
+        {
+            return prefab < PrefabMasks.size();
+        }
+
+        [[nodiscard]] inline std::vector<EntityType> Instantiate(SizeType prefab, SizeType count)
+        {
+            if (!HasPrefab(prefab))
+            {
+                return {};
+            }
+
+            return InstantiateFrom(PrefabSets, prefab, PrefabMasks[prefab], count);
+        }
+
+        [[nodiscard]] inline std::vector<EntityType> CloneEntity(EntityType entity, SizeType count = 1)
+        {
+            if (!HasEntity(entity))
+            {
+                return {};
+            }
+
+            BitsetType mask = GetMask(entity.GetID());
+
+            return InstantiateFrom(SparseSets, entity.GetID(), mask, count);
+        }
+
+        template <typename TResource, typename... TArgs>
+        requires CanBeComponent<TResource>
+        inline ReferenceResult<TResource> EmplaceResource(TArgs&&... args)
+        {
+            return Resources.template Emplace<TResource>(std::forward<TArgs>(args)...);
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline ReferenceResult<TResource> GetResource()
+        {
+            return Resources.template Get<TResource>();
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline ReferenceResult<const TResource> GetResource() const
+        {
+            return Resources.template Get<TResource>();
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline bool HasResource() const
+        {
+            return Resources.template Contains<TResource>();
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        inline bool RemoveResource()
+        {
+            return Resources.template Remove<TResource>();
+        }
+
+        template <typename TEvent>
+        requires CanBeComponent<TEvent>
+        inline ReferenceResult<EventChannel<TEvent>> CreateEventChannel()
+        {
+            ReferenceResult<EventChannel<TEvent>> result = Resources.template Emplace<EventChannel<TEvent>>();
+
+            if (result.Succeeded() && std::find(EventUpdaters.begin(), EventUpdaters.end(), &UpdateEventChannel<TEvent>) == EventUpdaters.end())
+            {
+                EventUpdaters.push_back(&UpdateEventChannel<TEvent>);
+            }
+
+            return result;
+        }
+
+        template <typename TEvent>
+        requires CanBeComponent<TEvent>
+        [[nodiscard]] inline ReferenceResult<EventChannel<TEvent>> GetEventChannel()
+        {
+            return Resources.template Get<EventChannel<TEvent>>();
+        }
+
+        template <typename TEvent>
+        requires CanBeComponent<TEvent>
+        [[nodiscard]] inline ReferenceResult<const EventChannel<TEvent>> GetEventChannel() const
+        {
+            return Resources.template Get<EventChannel<TEvent>>();
+        }
+
+        inline void UpdateEvents()
+        {
+            MINECS_PROFILE_SCOPE("ECS::UpdateEvents");
+
+            for (const auto& update : EventUpdaters)
+            {
+                update(Resources);
+            }
+        }
+
+        [[nodiscard]] inline ValueResult<EntityType> GetEntity(SizeType id) const
+        {
+            if (id >= Entities.size() || Entities[id].GetID() == std::numeric_limits<SizeType>::max())
+            {
+                return ValueResult<EntityType>(EntityType(std::numeric_limits<SizeType>::max(), 0), false);
+            }
+
+            return ValueResult<EntityType>(Entities[id], true);
+        }
+
+        [[nodiscard]] inline SizeType GetEntitySlotCount() const
+        {
+            return Entities.size();
+        }
+
+        template <typename... TQueried>
+        requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
+        [[nodiscard]] inline IterationCursor<ECS, TQueried...> MakeCursor(bool includeDisabled = false) const
+        {
+            return IterationCursor<ECS, TQueried...>(includeDisabled);
+        }
+
+        inline void PublishSnapshot(SnapshotPublisher<ECS>& publisher) const
+        {
+            MINECS_PROFILE_SCOPE("ECS::PublishSnapshot");
+
+            publisher.Publish(*this);
+        }
+
+        template <typename... TQueried>
+        requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
+        [[nodiscard]] inline SparseView<ECS, TQueried...> MakeSparseView(bool includeDisabled = false)
+        {
+            return SparseView<ECS, TQueried...>(this, includeDisabled);
+        }
+
+        [[nodiscard]] inline bool SetParent(EntityType child, EntityType parent)
+        {
+            if (!HasEntity(child) || !HasEntity(parent))
+            {
+                return false;
+            }
+
+            return Relationships.SetParent(child.GetID(), parent.GetID());
+        }
+
+        [[nodiscard]] inline bool RemoveParent(EntityType child)
+        {
+            if (!HasEntity(child))
+            {
+                return false;
+            }
+
+            return Relationships.RemoveParent(child.GetID());
+        }
+
+        [[nodiscard]] inline ValueResult<EntityType> GetParent(EntityType child) const
+        {
+            if (!HasEntity(child))
+            {
+                return ValueResult<EntityType>(EntityType(std::numeric_limits<SizeType>::max(), 0), false);
+            }
+
+            return GetEntity(Relationships.GetParentIndex(child.GetID()));
+        }
+
+        [[nodiscard]] inline typename Hierarchy<SizeType>::ChildRange GetChildren(EntityType parent) const
+        {
+            if (!HasEntity(parent))
+            {
+                return Relationships.GetChildren(Hierarchy<SizeType>::DeadIndex);
+            }
+
+            return Relationships.GetChildren(parent.GetID());
+        }
+
+        [[nodiscard]] inline const std::vector<SizeType>& GetHierarchyOrder()
+        {
+            return Relationships.GetOrder();
+        }
+
+        template <typename TComponent>
+        requires(DescriptorType::template Contains<TComponent>)
+        inline void SortByHierarchy()
+        {
+            MINECS_PROFILE_SCOPE("ECS::SortByHierarchy");
+
+            GetSparseSet<TComponent>().Arrange(Relationships.GetOrder());
+        }
+
+        [[nodiscard]] inline Hierarchy<SizeType>& GetHierarchy()
+        {
+            return Relationships;
+        }
+
+        [[nodiscard]] inline const Hierarchy<SizeType>& GetHierarchy() const
+        {
+            return Relationships;
+        }
+
+        [[nodiscard]] inline ArchetypeTreeType& GetArchetypess()
+        {
+            return Archetypes;
+        }
+
+        [[nodiscard]] inline const ArchetypeTreeType& GetArchetypes() const
+        {
+            return Archetypes;
+        }
+
+        [[nodiscard]] ReferenceResult<ArchetypeType> GetArchetype(const BitsetType& mask)
+        {
+            return Archetypes.Get(mask);
+        }
+
+        [[nodiscard]] ReferenceResult<const ArchetypeType> GetArchetype(const BitsetType& mask) const
+        {
+            return Archetypes.Get(mask);
+        }
+
+        template <typename TComponent>
+        requires(DescriptorType::template Contains<TComponent>)
+        [[nodiscard]] inline constexpr StorageType<TComponent>& GetSparseSet()
+        {
+            return std::get<DescriptorType::template Index<TComponent>()>(SparseSets);
+        }
+
+        template <typename TComponent>
+        requires(DescriptorType::template Contains<TComponent>)
+        [[nodiscard]] inline constexpr const StorageType<TComponent>& GetSparseSet() const
+        {
+            return std::get<DescriptorType::template Index<TComponent>()>(SparseSets);
+        }
+
+        template <typename... TQueried>
+        requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
+        [[nodiscard]] static inline constexpr BitsetType MakeBitmask()
+        {
+            BitsetType bitset;
+
+            (bitset.set(DescriptorType::template Index<TQueried>()), ...);
+
+            return bitset;
+        }
+
+        template <typename... TQueried, typename TFunction>
+        requires(DescriptorType::template Contains<TQueried> && ...)
+        inline void ForEachArchetype(TFunction&& function)
+        {
+            MINECS_PROFILE_SCOPE("ECS::ForEachArchetype");
+
+            if constexpr (sizeof...(TQueried) == 0)
+            {
+                Archetypes.ForEachMatching(BitsetType(), std::forward<TFunction>(function));
+            }
+            else
+            {
+                Archetypes.ForEachMatching(MakeBitmask<TQueried...>(), std::forward<TFunction>(function));
+            }
+        }
+
+        template <typename... TQueried, typename TFunction>
+        requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
+        inline void ForEach(TFunction&& function, bool includeDisabled = false)
+        {
+            MINECS_PROFILE_SCOPE("ECS::ForEach");
+
+            auto visitor = [this, &function, includeDisabled](const BitsetType&, ArchetypeType& archetype)
+            {
+                const RowMask* disabled = includeDisabled ? nullptr : GetDisabledRows(archetype);
+
+                if (!disabled)
+                {
+                    for (auto components : GetEntityView<TQueried...>(archetype, true))
+                    {
+                        std::apply(function, components);
+                    }
+
+                    return;
+                }
+
+                auto view = GetEntityView<TQueried...>(archetype, true);
+                SizeType size = archetype.Size();
+
+                for (SizeType word = 0; word * 64 < size; word++)
+                {
+                    std::uint64_t enabled = word < disabled->Words.size() ? ~disabled->Words[word] : ~std::uint64_t(0);
+
+                    if (size - word * 64 < 64)
+                    {
+                        enabled &= (std::uint64_t(1) << (size - word * 64)) - 1;
+                    }
+
+                    while (enabled)
+                    {
+                        std::apply(function, view[word * 64 + static_cast<SizeType>(std::countr_zero(enabled))]);
+
+                        enabled &= enabled - 1;
+                    }
+                }
+            };
+
+            ForEachDeclaredArchetype<TQueried...>(visitor, std::make_index_sequence<DescriptorType::ArchetypeCount>{});
+
+            Archetypes.ForEachMatching(MakeBitmask<TQueried...>(), visitor, DescriptorType::ArchetypeCount);
+        }
+
+        template <typename... TQueried>
+        requires(DescriptorType::template Contains<TQueried> && ...)
+        [[nodiscard]] inline auto GetEntityView(ArchetypeType& archetype, bool includeDisabled = false)
+        {
+            const RowMask* disabled = includeDisabled ? nullptr : GetDisabledRows(archetype);
+
+            return EntityView<ECS<DescriptorType>, SizeType, TQueried...>(this, archetype, disabled ? &disabled->Words : nullptr);
+        }
+
+        template <typename... TQueried>
+        requires(DescriptorType::template Contains<TQueried> && ...)
+        [[nodiscard]] inline auto GetEntityView(const ArchetypeType& archetype, bool includeDisabled = false) const
+        {
+            const RowMask* disabled = includeDisabled ? nullptr : GetDisabledRows(archetype);
+
+            return EntityView<const ECS<DescriptorType>, SizeType, TQueried...>(this, archetype, disabled ? &disabled->Words : nullptr);
+        }
+
+    private:
+        struct RowMask
+        {
+            std::vector<std::uint64_t> Words;
+            SizeType Count = 0;
+        };
+
+        template <std::size_t... Ns>
+        inline void RegisterArchetypes(std::index_sequence<Ns...>)
+        {
+            (RegisterArchetype(std::type_identity<std::tuple_element_t<Ns, typename DescriptorType::ArchetypeDeclarations>>{}), ...);
+        }
+
+        template <std::size_t... Ns>
+        inline void SampleComponentCapacity(CapacityProfile& profile, std::index_sequence<Ns...>) const
+        {
+            (profile.RecordComponent(Ns, std::get<Ns>(SparseSets).Size()), ...);
+        }
+
+        template <std::size_t... Ns>
+        inline void ApplyComponentCapacity(const CapacityProfile& profile, std::index_sequence<Ns...>)
+        {
+            (ReserveStorage<Ns>(static_cast<SizeType>(profile.GetComponent(Ns))), ...);
+        }
+
+        template <std::size_t... Ns>
+        inline void ReserveStorages(SizeType count, std::index_sequence<Ns...>)
+        {
+            (ReserveStorage<Ns>(count), ...);
+        }
+
+        template <std::size_t N>
+        inline void ReserveStorage(SizeType count)
+        {
+            auto& storage = std::get<N>(SparseSets);
+
+            if constexpr (IsDirectSet<std::remove_reference_t<decltype(storage)>>)
+            {
+                SizeType slots = static_cast<SizeType>(Entities.capacity());
+
+                storage.Reserve(count > slots ? count : slots);
+            }
+            else if (count != 0)
+            {
+                storage.Reserve(count);
+            }
+        }
+
+        template <typename... TDeclared>
+        inline void RegisterArchetype(std::type_identity<Archetype<TDeclared...>>)
+        {
+            BitsetType mask = MakeBitmask<TDeclared...>();
+
+            static_cast<void>(Archetypes.Insert(mask));
+
+            Archetypes.Pin(mask);
+        }
+
+        template <typename... TQueried, typename TVisitor, std::size_t... Ns>
+        inline void ForEachDeclaredArchetype(TVisitor& visitor, std::index_sequence<Ns...>)
+        {
+            ((ArchetypeHasComponents<std::tuple_element_t<Ns, typename DescriptorType::ArchetypeDeclarations>, TQueried...> ? visitor(Archetypes.At(Ns).first, Archetypes.At(Ns).second) : void()), ...);
+        }
+
+        [[nodiscard]] inline bool UpdateArchetype(EntityType entity, const BitsetType& oldBitset, const BitsetType& newBitset)
+        {
+            MINECS_PROFILE_SCOPE("ECS::UpdateArchetype");
+
+            if (oldBitset == newBitset)
+            {
+                std::cerr << "Failed to insert entity " << entity.GetID() << " into archetype: same bitset\n";
+
+                return false;
+            }
+
+            bool enabled = IsRowEnabled(Records[entity.GetID()]);
+            SizeType previous = DisplaceEntity(entity.GetID());
+            SizeType archetypeIndex = Archetypes.InsertIndex(newBitset).GetValue();
+
+            ReleaseArchetype(previous);
+
+            if (!PlaceEntity(archetypeIndex, entity, enabled))
+            {
+                std::cerr << "Failed to add entity " << entity.GetID() << " to new archetype\n";
+
+                return false;
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] inline bool PlaceEntity(SizeType archetypeIndex, EntityType entity, bool enabled = true)
+        {
+            ArchetypeType& archetype = Archetypes.At(archetypeIndex).second;
+
+            if (archetype.Insert(entity.GetID(), entity).Failed())
+            {
+                return false;
+            }
+
+            EntityRecord& record = Records[entity.GetID()];
+
+            record = {archetypeIndex, archetype.Size() - 1};
+
+            if (!enabled)
+            {
+                SetRowEnabled(record, false);
+            }
+
+            return true;
+        }
+
+        inline SizeType DisplaceEntity(SizeType id)
+        {
+            EntityRecord& record = Records[id];
+            SizeType archetypeIndex = record.Archetype;
+
+            if (archetypeIndex == NoArchetype)
+            {
+                return NoArchetype;
+            }
+
+            ArchetypeType& archetype = Archetypes.At(archetypeIndex).second;
+            SizeType moved = archetype.GetDense().back().GetID();
+            EntityRecord last = {archetypeIndex, archetype.Size() - 1};
+
+            SetRowEnabled(record, IsRowEnabled(last));
+            SetRowEnabled(last, true);
+
+            static_cast<void>(archetype.Remove(id));
+
+            if (moved != id)
+            {
+                Records[moved].Row = record.Row;
+            }
+
+            record = {NoArchetype, NoArchetype};
+
+            return archetypeIndex;
+        }
+
+        [[nodiscard]] inline bool IsRowEnabled(const EntityRecord& record) const
+        {
+            if (record.Archetype >= DisabledRows.size())
+            {
+                return true;
+            }
+
+            const RowMask& mask = DisabledRows[record.Archetype];
+            SizeType word = record.Row / 64;
+
+            return mask.Count == 0 || word >= mask.Words.size() || !((mask.Words[word] >> (record.Row % 64)) & 1);
+        }
+
+        inline void SetRowEnabled(const EntityRecord& record, bool enabled)
+        {
+            if (record.Archetype >= DisabledRows.size())
+            {
+                if (enabled)
+                {
+                    return;
+                }
+
+                DisabledRows.resize(record.Archetype + 1);
+            }
+
+            RowMask& mask = DisabledRows[record.Archetype];
+            SizeType word = record.Row / 64;
+            std::uint64_t bit = std::uint64_t(1) << (record.Row % 64);
+
+            if (word >= mask.Words.size())
+            {
+                if (enabled)
+                {
+                    return;
+                }
+
+                mask.Words.resize(word + 1, 0);
+            }
+
+            if (((mask.Words[word] & bit) == 0) == enabled)
+            {
+                return;
+            }
+
+            mask.Words[word] ^= bit;
+            mask.Count = enabled ? mask.Count - 1 : mask.Count + 1;
+        }
+
+        [[nodiscard]] inline const RowMask* GetDisabledRows(const ArchetypeType& archetype) const
+        {
+            if (archetype.Empty())
+            {
+                return nullptr;
+            }
+
+            SizeType archetypeIndex = Records[archetype.GetDense().front().GetID()].Archetype;
+
+            if (archetypeIndex >= DisabledRows.size() || DisabledRows[archetypeIndex].Count == 0)
+            {
+                return nullptr;
+            }
+
+            return &DisabledRows[archetypeIndex];
+        }
+
+        [[nodiscard]] inline const BitsetType& GetMask(SizeType id) const
+        {
+            SizeType archetypeIndex = Records[id].Archetype;
+
+            return archetypeIndex == NoArchetype ? EmptyMask : Archetypes.At(archetypeIndex).first;
+        }
+
+        inline void MigrateEntities(const std::vector<EntityType>& batch, const BitsetType& bits, bool add)
+        {
+            MINECS_PROFILE_SCOPE("ECS::MigrateEntities");
+
+            std::vector<std::pair<SizeType, SizeType>> order;
+
+            order.reserve(batch.size());
+
+            for (SizeType i = 0; i < batch.size(); i++)
+            {
+                order.emplace_back(Records[batch[i].GetID()].Archetype, i);
+            }
+
+            std::sort(order.begin(), order.end());
+
+            for (std::size_t begin = 0, end = 0; begin < order.size(); begin = end)
+            {
+                SizeType sourceIndex = order[begin].first;
+
+                while (end < order.size() && order[end].first == sourceIndex)
+                {
+                    end++;
+                }
+
+                BitsetType source = GetMask(batch[order[begin].second].GetID());
+                BitsetType destination = add ? source | bits : source & ~bits;
+
+                SizeType targetIndex = Archetypes.InsertIndex(destination).GetValue();
+                ArchetypeType& target = Archetypes.At(targetIndex).second;
+
+                target.Reserve(target.Size() + static_cast<SizeType>(end - begin));
+
+                for (std::size_t k = begin; k < end; k++)
+                {
+                    const EntityType& entity = batch[order[k].second];
+
+                    bool enabled = IsRowEnabled(Records[entity.GetID()]);
+
+                    static_cast<void>(DisplaceEntity(entity.GetID()));
+                    static_cast<void>(PlaceEntity(targetIndex, entity, enabled));
+                }
+
+                ReleaseArchetype(sourceIndex);
+            }
+        }
+
+        template <std::size_t N>
+        inline void RemoveComponentAt(EntityType entity)
+        {
+            ComponentRemoved<N>(entity);
+
+            if (Log)
+            {
+                Log->Append(JournalType::Operation::Remove, static_cast<std::uint16_t>(N), entity.GetID(), entity.GetGeneration());
+            }
+
+            static_cast<void>(std::get<N>(SparseSets).Remove(entity.GetID()));
+        }
+
+        template <std::size_t... Ns>
+        inline void RemoveEntityFromSparseSetsImplementation(EntityType entity, const BitsetType& mask, std::index_sequence<Ns...>)
+        {
+            ((mask.test(Ns) ? (ComponentRemoved<Ns>(entity), static_cast<void>(std::get<Ns>(SparseSets).Remove(entity.GetID()))) : void()), ...);
+        }
+
+        inline void RemoveEntityFromSparseSets(EntityType entity, const BitsetType& mask)
+        {
+            RemoveEntityFromSparseSetsImplementation(entity, mask, std::make_index_sequence<DescriptorType::ComponentCount>{});
+        }
+
+        template <typename TSources>
+        [[nodiscard]] inline std::vector<EntityType> InstantiateFrom(TSources& sources, SizeType source, const BitsetType& mask, SizeType count)
+        {
+            MINECS_PROFILE_SCOPE("ECS::Instantiate");
+
+            std::vector<EntityType> entities = CreateBlankEntities(count);
+
+            if (mask.none() || count == 0)
+            {
+                return entities;
+            }
+
+            SizeType archetypeIndex = Archetypes.InsertIndex(mask).GetValue();
+            ArchetypeType& archetype = Archetypes.At(archetypeIndex).second;
+            std::vector<SizeType> ids;
+
+            archetype.Reserve(archetype.Size() + count);
+            ids.reserve(count);
+
+            for (const auto& entity : entities)
+            {
+                ids.push_back(entity.GetID());
+
+                static_cast<void>(PlaceEntity(archetypeIndex, entity));
+            }
+
+            FillSparseSets(sources, source, ids, mask, std::make_index_sequence<DescriptorType::ComponentCount>{});
+
+            return entities;
+        }
+
+        template <typename TSources, std::size_t... Ns>
+        inline void FillSparseSets(TSources& sources, SizeType source, const std::vector<SizeType>& ids, const BitsetType& mask, std::index_sequence<Ns...>)
+        {
+            ((mask.test(Ns) ? FillSparseSet<Ns>(sources, source, ids) : void()), ...);
+        }
+
+        template <std::size_t N, typename TSources>
+        inline void FillSparseSet(TSources& sources, SizeType source, const std::vector<SizeType>& ids)
+        {
+            std::get<N>(SparseSets).Fill(ids, std::get<N>(sources).Get(source).GetValue());
+
+            if (IsObserved<N>())
+            {
+                for (const SizeType& id : ids)
+                {
+                    ComponentInserted<N>(Entities[id]);
+                }
+            }
+        }
+
+        template <std::size_t... Ns>
+        inline void CopyPrefabComponents(SizeType id, SizeType prefab, const BitsetType& mask, std::index_sequence<Ns...>)
+        {
+            ((mask.test(Ns) ? static_cast<void>(std::get<Ns>(PrefabSets).Insert(prefab, std::get<Ns>(SparseSets).Get(id).GetValue())) : void()), ...);
+        }
+
+        template <std::size_t... Ns>
+        inline void MergeSparseSets(ECS& other, const std::vector<EntityType>& remap, std::index_sequence<Ns...>)
+        {
+            auto remapIndex = [&remap](SizeType index)
+            {
+                return remap[index].GetID();
+            };
+
+            (MergeSparseSet<Ns>(other, remapIndex), ...);
+        }
+
+        template <std::size_t N, typename TRemap>
+        inline void MergeSparseSet(ECS& other, TRemap& remapIndex)
+        {
+            auto& otherSet = std::get<N>(other.SparseSets);
+
+            if (!IsObserved<N>())
+            {
+                std::get<N>(SparseSets).Merge(otherSet, remapIndex);
+
+                return;
+            }
+
+            std::vector<SizeType> ids;
+
+            ids.reserve(otherSet.Size());
+
+            otherSet.ForEach([&ids, &remapIndex](SizeType id, const auto&)
+            {
+                ids.push_back(remapIndex(id));
+            });
+
+            std::get<N>(SparseSets).Merge(otherSet, remapIndex);
+
+            for (const SizeType& id : ids)
+            {
+                ComponentInserted<N>(Entities[id]);
+            }
+        }
+
+        template <std::size_t N>
+        inline void MoveComponent(ECS& other, SizeType from, SizeType to)
+        {
+            auto& source = std::get<N>(other.SparseSets);
+            auto result = source.Get(from);
+
+            if (result.Failed())
+            {
+                return;
+            }
+
+            other.template ComponentRemoved<N>(other.Entities[from]);
+
+            static_cast<void>(std::get<N>(SparseSets).Insert(to, std::move(result.GetValue())));
+            static_cast<void>(source.Remove(from));
+
+            ComponentInserted<N>(Entities[to]);
+        }
+
+        template <std::size_t... Ns>
+        inline void MoveEntityComponents(ECS& other, SizeType from, SizeType to, const BitsetType& mask, std::index_sequence<Ns...>)
+        {
+            ((mask.test(Ns) ? MoveComponent<Ns>(other, from, to) : void()), ...);
+        }
+
+        template <typename T, typename U>
+        inline bool AddEntityToSparseSet(EntityType& entity, U&& component)
+        {
+            using ResultType = ReferenceResult<T>;
+
+            StorageType<T>& sparseSet = GetSparseSet<T>();
+            ResultType result = sparseSet.Insert(entity.GetID(), std::forward<U>(component));
+
+            if (result.Failed())
+            {
+                return false;
+            }
+
+            ComponentInserted<DescriptorType::template Index<T>()>(entity);
+
+            return true;
+        }
+
+        template <std::size_t N>
+        [[nodiscard]] inline bool IsObserved() const
+        {
+            return Log || !std::get<N>(Indices).empty();
+        }
+
+        template <std::size_t N>
+        inline void ComponentInserted(EntityType entity)
+        {
+            if (!IsObserved<N>())
+            {
+                return;
+            }
+
+            const auto& component = std::get<N>(SparseSets).GetUnchecked(entity.GetID());
+
+            JournalComponent<N>(JournalType::Operation::Add, entity, component);
+
+            for (auto& index : std::get<N>(Indices))
+            {
+                index->Insert(entity, component);
+            }
+        }
+
+        template <std::size_t N, typename TComponent>
+        inline void ComponentUpdated(EntityType entity, const TComponent& component)
+        {
+            JournalComponent<N>(JournalType::Operation::Write, entity, component);
+
+            for (auto& index : std::get<N>(Indices))
+            {
+                index->Update(entity, component);
+            }
+        }
+
+        inline void JournalEntity(typename JournalType::Operation operation, EntityType entity)
+        {
+            if (Log)
+            {
+                Log->Append(operation, 0, entity.GetID(), entity.GetGeneration());
+            }
+        }
+
+        template <std::size_t N, typename TComponent>
+        inline void JournalComponent(typename JournalType::Operation operation, EntityType entity, const TComponent& component)
+        {
+            if constexpr (std::is_trivially_copyable_v<TComponent>)
+            {
+                if (Log)
+                {
+                    Log->Append(operation, static_cast<std::uint16_t>(N), entity.GetID(), entity.GetGeneration(), &component, sizeof(TComponent));
+                }
+            }
+        }
+
+        inline void RestoreEntity(SizeType id, SizeType generation)
+        {
+            if (id >= Entities.size())
+            {
+                Entities.resize(id + 1, EntityType(std::numeric_limits<SizeType>::max(), 0));
+                Records.resize(id + 1, {NoArchetype, NoArchetype});
+            }
+            else if (!FreeList.empty() && FreeList.back() == id)
+            {
+                FreeList.pop_back();
+            }
+            else
+            {
+                auto found = std::find(FreeList.begin(), FreeList.end(), id);
+
+                if (found != FreeList.end())
+                {
+                    FreeList.erase(found);
+                }
+            }
+
+            Entities[id] = EntityType(id, generation);
+            Records[id] = {NoArchetype, NoArchetype};
+        }
+
+        inline void ApplyRecord(const typename JournalType::Record& record, const std::byte* payload)
+        {
+            using Operation = typename JournalType::Operation;
+
+            switch (record.Type)
+            {
+                case Operation::Create:
+                    RestoreEntity(record.ID, record.Generation);
+                    break;
+                case Operation::Destroy:
+                    static_cast<void>(DestroyEntity(EntityType(record.ID, record.Generation)));
+                    break;
+                case Operation::Clear:
+                    Clear();
+                    break;
+                case Operation::Reserve:
+                    Entities.reserve(record.ID);
+                    Records.reserve(record.ID);
+                    break;
+                case Operation::Free:
+                    if (record.ID >= Entities.size())
+                    {
+                        Entities.resize(record.ID + 1, EntityType(std::numeric_limits<SizeType>::max(), 0));
+                        Records.resize(record.ID + 1, {NoArchetype, NoArchetype});
+                    }
+
+                    Entities[record.ID] = EntityType(std::numeric_limits<SizeType>::max(), record.Generation);
+                    FreeList.push_back(record.ID);
+                    break;
+                default:
+                    ApplyComponentRecord(record, payload, std::make_index_sequence<DescriptorType::ComponentCount>{});
+                    break;
+            }
+        }
+
+        template <std::size_t... Ns>
+        inline void ApplyComponentRecord(const typename JournalType::Record& record, const std::byte* payload, std::index_sequence<Ns...>)
+        {
+            ((record.Component == Ns ? ApplyComponentRecordAt<Ns>(record, payload) : void()), ...);
+        }
+
+        template <std::size_t N>
+        inline void ApplyComponentRecordAt(const typename JournalType::Record& record, const std::byte* payload)
+        {
+            using ComponentType = ComponentTypeOf<std::tuple_element_t<N, typename DescriptorType::ComponentDeclarations>>;
+            using Operation = typename JournalType::Operation;
+
+            if (record.ID >= Entities.size())
+            {
+                return;
+            }
+
+            EntityType entity = Entities[record.ID];
+
+            if (record.Type == Operation::Remove)
+            {
+                static_cast<void>(RemoveComponentFromEntity<ComponentType>(entity));
+
+                return;
+            }
+
+            if (record.Size != sizeof(ComponentType))
+            {
+                return;
+            }
+
+            std::array<std::byte, sizeof(ComponentType)> bytes;
+
+            std::memcpy(bytes.data(), payload, sizeof(ComponentType));
+
+            if (record.Type == Operation::Add)
+            {
+                static_cast<void>(AddComponentToEntity<ComponentType>(entity, std::bit_cast<ComponentType>(bytes)));
+            }
+            else if (record.Type == Operation::Write)
+            {
+                static_cast<void>(SetComponent<ComponentType>(entity, std::bit_cast<ComponentType>(bytes)));
+            }
+        }
+
+        template <std::size_t... Ns>
+        inline void SnapshotComponents(JournalType& journal, std::index_sequence<Ns...>) const
+        {
+            (SnapshotComponentsAt<Ns>(journal), ...);
+        }
+
+        template <std::size_t N>
+        inline void SnapshotComponentsAt(JournalType& journal) const
+        {
+            using ComponentType = ComponentTypeOf<std::tuple_element_t<N, typename DescriptorType::ComponentDeclarations>>;
+
+            std::get<N>(SparseSets).ForEach([this, &journal](SizeType id, const ComponentType& component)
+            {
+                journal.Append(JournalType::Operation::Add, static_cast<std::uint16_t>(N), id, Entities[id].GetGeneration(), &component, sizeof(ComponentType));
+            });
+        }
+
+        template <std::size_t N>
+        inline void ComponentRemoved(EntityType entity)
+        {
+            for (auto& index : std::get<N>(Indices))
+            {
+                index->Remove(entity);
+            }
+        }
+
+        template <typename TIndex>
+        inline TIndex& AddIndex(std::unique_ptr<TIndex> index)
+        {
+            using ComponentType = typename TIndex::ComponentType;
+
+            constexpr std::size_t N = DescriptorType::template Index<ComponentType>();
+
+            auto& set = std::get<N>(SparseSets);
+            TIndex& reference = *index;
+
+            set.ForEach([this, &reference](SizeType id, const ComponentType& component)
+            {
+                reference.Insert(Entities[id], component);
+            });
+
+            std::get<N>(Indices).push_back(std::move(index));
+
+            return reference;
+        }
+
+        template <std::size_t... Ns>
+        inline void CompactStorageImplementation(std::index_sequence<Ns...>)
+        {
+            (CompactStorageAt<Ns>(), ...);
+        }
+
+        template <std::size_t N>
+        inline void CompactStorageAt()
+        {
+            if constexpr (IsStableSet<std::tuple_element_t<N, decltype(SparseSets)>>)
+            {
+                std::get<N>(SparseSets).Compact();
+            }
+
+            std::get<N>(SparseSets).Trim();
+        }
+
+        template <std::size_t... Ns>
+        inline void SwapBuffersImplementation(std::index_sequence<Ns...>)
+        {
+            (SwapBuffersAt<Ns>(), ...);
+        }
+
+        template <std::size_t N>
+        inline void SwapBuffersAt()
+        {
+            if constexpr (IsDoubleBufferedSet<std::tuple_element_t<N, decltype(SparseSets)>>)
+            {
+                std::get<N>(SparseSets).SwapBuffers();
+            }
+        }
+
+        inline void ReleaseArchetype(SizeType index)
+        {
+            if (index == NoArchetype || !Archetypes.IsAlive(index) || !Archetypes.At(index).second.Empty())
+            {
+                return;
+            }
+
+            if (RetentionFrames == 0)
+            {
+                BitsetType bitset = Archetypes.At(index).first;
+
+                Archetypes.Remove(bitset);
+
+                return;
+            }
+
+            if (index >= EmptySince.size())
+            {
+                EmptySince.resize(index + 1, Frame);
+            }
+
+            EmptySince[index] = Frame;
+        }
+
+        template <std::size_t... Ns>
+        inline void ClearSparseSets(std::index_sequence<Ns...>)
+        {
+            (std::get<Ns>(SparseSets).Clear(), ...);
+
+            ((ClearIndices(std::get<Ns>(Indices))), ...);
+        }
+
+        [[nodiscard]] inline bool MatchesArchetypeLayout(const std::vector<BitsetType>& masks, const std::vector<std::uint8_t>& flags) const
+        {
+            if (masks.size() != Archetypes.Size())
+            {
+                return false;
+            }
+
+            for (SizeType index = 0; index < masks.size(); index++)
+            {
+                bool alive = Archetypes.IsAlive(index);
+
+                if (Archetypes.At(index).first != masks[index] || alive != ((flags[index] & AliveArchetype) != 0) || (alive && Archetypes.IsPinned(masks[index]) != ((flags[index] & PinnedArchetype) != 0)))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template <std::size_t... Ns>
+        inline void SaveRollbackComponents(RollbackBuffer& buffer, std::index_sequence<Ns...>) const
+        {
+            (SaveRollbackComponent<Ns>(buffer), ...);
+        }
+
+        template <std::size_t N>
+        inline void SaveRollbackComponent(RollbackBuffer& buffer) const
+        {
+            using Storage = std::tuple_element_t<N, decltype(SparseSets)>;
+            using ComponentType = typename Storage::Type;
+
+            const Storage& storage = std::get<N>(SparseSets);
+
+            if constexpr (IsSparseSet<Storage>)
+            {
+                buffer.Capture(storage.GetDense());
+                buffer.Capture(storage.GetSparse());
+                buffer.Capture(storage.GetReverseMapping());
+            }
+            else
+            {
+                std::vector<SizeType> ids;
+                std::vector<ComponentType> components;
+
+                ids.reserve(storage.Size());
+                components.reserve(storage.Size());
+
+                storage.ForEach([&ids, &components](SizeType id, const ComponentType& component)
+                {
+                    ids.push_back(id);
+                    components.push_back(component);
+                });
+
+                buffer.Capture(ids);
+                buffer.Capture(components);
+            }
+        }
+
+        template <std::size_t... Ns>
+        inline void LoadRollbackComponents(RollbackBuffer& buffer, std::index_sequence<Ns...>)
+        {
+            (LoadRollbackComponent<Ns>(buffer), ...);
+        }
+
+        template <std::size_t N>
+        inline void LoadRollbackComponent(RollbackBuffer& buffer)
+        {
+            using Storage = std::tuple_element_t<N, decltype(SparseSets)>;
+            using ComponentType = typename Storage::Type;
+
+            Storage& storage = std::get<N>(SparseSets);
+
+            if constexpr (IsSparseSet<Storage>)
+            {
+                buffer.Restore(storage.GetDense());
+                buffer.Restore(storage.GetSparse());
+                buffer.Restore(storage.GetReverseMapping());
+            }
+            else
+            {
+                std::vector<SizeType> ids;
+                std::vector<ComponentType> components;
+
+                buffer.Restore(ids);
+                buffer.Restore(components);
+
+                storage.Clear();
+
+                for (SizeType i = 0; i < ids.size(); i++)
+                {
+                    static_cast<void>(storage.Insert(ids[i], components[i]));
+                }
+            }
+
+            auto& indices = std::get<N>(Indices);
+
+            ClearIndices(indices);
+
+            if (indices.empty())
+            {
+                return;
+            }
+
+            storage.ForEach([this, &indices](SizeType id, const ComponentType& component)
+            {
+                for (auto& index : indices)
+                {
+                    index->Insert(Entities[id], component);
+                }
+            });
+        }
+
+        template <typename TEvent>
+        static inline void UpdateEventChannel(ResourceRegistry<SizeType>& resources)
+        {
+            ReferenceResult<EventChannel<TEvent>> channel = resources.template Get<EventChannel<TEvent>>();
+
+            if (channel.Succeeded())
+            {
+                channel.GetValue().Update();
+            }
+        }
+
+        template <typename TIndices>
+        static inline void ClearIndices(TIndices& indices)
+        {
+            for (auto& index : indices)
+            {
+                index->Clear();
+            }
+        }
+
+        typename TransformTuple<typename DescriptorType::ComponentDeclarations, StorageFor>::Type SparseSets;
+        typename TransformTuple<typename DescriptorType::ComponentDeclarations, PrefabStorageFor>::Type PrefabSets;
+        typename TransformTuple<typename DescriptorType::ComponentDeclarations, IndicesFor>::Type Indices;
+
+        ArchetypeTreeType Archetypes;
+
+        static constexpr BitsetType EmptyMask{};
+
+        std::vector<RowMask> DisabledRows;
+
+        std::vector<EntityRecord> Records;
+        std::vector<EntityType> Entities;
+        std::vector<SizeType> FreeList;
+        std::vector<BitsetType> PrefabMasks;
+
+        ResourceRegistry<SizeType> Resources;
+        std::vector<void (*)(ResourceRegistry<SizeType>&)> EventUpdaters;
+
+        Hierarchy<SizeType> Relationships;
+
+        static constexpr SizeType MinimumDeadArchetypes = 64;
+        static constexpr std::uint8_t AliveArchetype = 1;
+        static constexpr std::uint8_t PinnedArchetype = 2;
+
+        std::vector<SizeType> EmptySince;
+        std::size_t RetentionBudget = std::numeric_limits<std::size_t>::max();
+        SizeType RetentionFrames = 0;
+        SizeType Frame = 0;
+
+        JournalType* Log = nullptr;
     };
 }
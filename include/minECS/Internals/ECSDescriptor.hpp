@@ -4,36 +4,82 @@
 
 #include <array>
 #include <limits>
+#include <tuple>
 
 namespace minECS
 {
     template <typename TSizeType, typename... TComponents>
-    requires ComponentsAreUnique<TComponents...> && CanBeComponents<TComponents...> && IsSizeType<TSizeType>
+    requires ComponentsAreUnique<ComponentTypeOf<TComponents>...> && CanBeComponents<ComponentTypeOf<TComponents>...> && IsSizeType<TSizeType>
     class ECSDescriptor
     {
     public:
         using SizeType = TSizeType;
 
+        using ComponentDeclarations = decltype(std::tuple_cat(std::declval<std::conditional_t<IsArchetype<TComponents>, std::tuple<>, std::tuple<TComponents>>>()...));
+        using ArchetypeDeclarations = decltype(std::tuple_cat(std::declval<std::conditional_t<IsArchetype<TComponents>, std::tuple<TComponents>, std::tuple<>>>()...));
+
+        static constexpr std::size_t ComponentCount = std::tuple_size_v<ComponentDeclarations>;
+        static constexpr std::size_t ArchetypeCount = std::tuple_size_v<ArchetypeDeclarations>;
+
         ECSDescriptor() = delete;
 
         template <typename TComponent>
-        static constexpr bool Contains = (std::is_same_v<TComponent, TComponents> || ...);
+        static constexpr bool Contains = ((!IsArchetype<TComponents> && std::is_same_v<TComponent, ComponentTypeOf<TComponents>>) || ...);
 
         template <typename TComponent>
         requires Contains<TComponent>
         static constexpr std::size_t Index()
         {
-            constexpr std::array<bool, sizeof...(TComponents)> matchFlags = {std::is_same_v<TComponent, TComponents>...};
+            constexpr std::array<bool, sizeof...(TComponents)> matchFlags = {std::is_same_v<TComponent, ComponentTypeOf<TComponents>>...};
+            constexpr std::array<bool, sizeof...(TComponents)> archetypeFlags = {IsArchetype<TComponents>...};
+
+            std::size_t index = 0;
 
             for (std::size_t i = 0; i < matchFlags.size(); i++)
             {
+                if (archetypeFlags[i])
+                {
+                    continue;
+                }
+
                 if (matchFlags[i])
                 {
-                    return i;
+                    return index;
                 }
+
+                index++;
             }
 
             return std::numeric_limits<SizeType>::max();
         }
+
+        template <typename... TQueried>
+        static constexpr std::size_t ArchetypeIndex()
+        {
+            return ArchetypeIndexImplementation<TQueried...>(std::make_index_sequence<ArchetypeCount>{});
+        }
+
+        template <typename TComponent>
+        requires Contains<TComponent>
+        using StorageType = ComponentStorageOf<std::tuple_element_t<Index<TComponent>(), ComponentDeclarations>, SizeType>;
+
+    private:
+        template <typename... TQueried, std::size_t... Ns>
+        static constexpr std::size_t ArchetypeIndexImplementation(std::index_sequence<Ns...>)
+        {
+            constexpr std::array<bool, ArchetypeCount> matchFlags = {ArchetypeMatches<std::tuple_element_t<Ns, ArchetypeDeclarations>, TQueried...>...};
+
+            for (std::size_t i = 0; i < matchFlags.size(); i++)
+            {
+                if (matchFlags[i])
+                {
+                    return i;
+                }
+            }
+
+            return ArchetypeCount;
+        }
+
+        static_assert((ArchetypeIsDeclared<TComponents, ComponentTypeOf<TComponents>...> && ...), "Archetype declarations may only name components declared in the same descriptor");
     };
-}
\ No newline at end of file
+}
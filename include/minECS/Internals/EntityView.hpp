@@ -4,83 +4,243 @@
 #include <minECS/Internals/SparseSet.hpp>
 #include <minECS/Internals/Traits.hpp>
 
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 namespace minECS
 {
     template <typename TECS, typename TSizeType, typename... TComponents>
-    requires IsECS<TECS> && IsSizeType<TSizeType> && ComponentsAreUnique<TComponents...> && (TECS::DescriptorType::template Contains<TComponents> && ...)
-    class EntityView
+    requires IsECS<std::remove_const_t<TECS>> && IsSizeType<TSizeType> && ComponentsAreUnique<TComponents...> && (TECS::DescriptorType::template Contains<TComponents> && ...)
+    class EntityView : public std::ranges::view_interface<EntityView<TECS, TSizeType, TComponents...>>
     {
     public:
         using SizeType = TSizeType;
+        using EntityType = Entity<SizeType>;
+
+        template <typename T>
+        using QualifiedType = std::conditional_t<std::is_const_v<TECS>, const T, T>;
+
+        using StoragesType = std::tuple<QualifiedType<typename TECS::template StorageType<TComponents>>*...>;
+        using ArchetypeType = QualifiedType<typename std::remove_const_t<TECS>::ArchetypeType>;
+        using RowsType = std::shared_ptr<const std::vector<SizeType>>;
 
         class Iterator
         {
         public:
-            Iterator(TECS* ecs, SparseSet<Entity<SizeType>, SizeType>* entities, SizeType index, SizeType end)
-                : ECS(ecs), Entities(entities), Index(index), End(end)
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::tuple<EntityType, QualifiedType<TComponents>&...>;
+            using reference = value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+
+            Iterator() = default;
+
+            Iterator(const EntityType* entities, const RowsType& rows, const StoragesType& storages, difference_type index)
+                : Entities(entities), Rows(rows), Storages(storages), Index(index)
             {
             }
 
-            auto operator*() const
+            [[nodiscard]] reference operator*() const
             {
-                Entity<SizeType> targetEntity = Entities->GetDense()[Index];
+                return Dereference(Entities[Rows ? (*Rows)[Index] : Index], std::index_sequence_for<TComponents...>{});
+            }
 
-                return std::tuple<Entity<SizeType>, TComponents&...>(targetEntity, ECS->template GetSparseSet<TComponents>().GetDense()[ECS->template GetSparseSet<TComponents>().GetSparse()[targetEntity.GetID()]]...);
+            [[nodiscard]] reference operator[](difference_type offset) const
+            {
+                return *(*this + offset);
             }
 
-            bool operator!=(const EntityView::Iterator&) const
+            Iterator& operator++()
             {
-                return Index < End;
+                ++Index;
+
+                return *this;
             }
 
-            EntityView::Iterator& operator++()
+            Iterator operator++(int)
             {
+                Iterator copy = *this;
+
                 ++Index;
 
+                return copy;
+            }
+
+            Iterator& operator--()
+            {
+                --Index;
+
                 return *this;
             }
 
+            Iterator operator--(int)
+            {
+                Iterator copy = *this;
+
+                --Index;
+
+                return copy;
+            }
+
+            Iterator& operator+=(difference_type offset)
+            {
+                Index += offset;
+
+                return *this;
+            }
+
+            Iterator& operator-=(difference_type offset)
+            {
+                Index -= offset;
+
+                return *this;
+            }
+
+            [[nodiscard]] friend Iterator operator+(Iterator iterator, difference_type offset)
+            {
+                return iterator += offset;
+            }
+
+            [[nodiscard]] friend Iterator operator+(difference_type offset, Iterator iterator)
+            {
+                return iterator += offset;
+            }
+
+            [[nodiscard]] friend Iterator operator-(Iterator iterator, difference_type offset)
+            {
+                return iterator -= offset;
+            }
+
+            [[nodiscard]] friend difference_type operator-(const Iterator& left, const Iterator& right)
+            {
+                return left.Index - right.Index;
+            }
+
+            [[nodiscard]] friend bool operator==(const Iterator& left, const Iterator& right)
+            {
+                return left.Index == right.Index;
+            }
+
+            [[nodiscard]] friend std::strong_ordering operator<=>(const Iterator& left, const Iterator& right)
+            {
+                return left.Index <=> right.Index;
+            }
+
         private:
-            TECS* ECS;
+            template <std::size_t... Ns>
+            [[nodiscard]] reference Dereference(EntityType entity, std::index_sequence<Ns...>) const
+            {
+                return reference(entity, std::get<Ns>(Storages)->GetUnchecked(entity.GetID())...);
+            }
+
+            const EntityType* Entities = nullptr;
 
-            SparseSet<Entity<SizeType>, SizeType>* Entities;
+            RowsType Rows;
 
-            SizeType Index;
-            SizeType End;
+            StoragesType Storages;
+
+            difference_type Index = 0;
         };
 
-        using ConstIterator = const Iterator;
+        using ConstIterator = Iterator;
+
+        EntityView() = default;
 
-        EntityView(TECS* ecs, SparseSet<Entity<SizeType>, SizeType>& entities)
-            : ECS(ecs), Entities(&entities), End(entities.GetDense().size())
+        EntityView(TECS* ecs, ArchetypeType& entities, const std::vector<std::uint64_t>* disabled = nullptr)
+            : Entities(entities.GetDense().data()), Count(entities.GetDense().size()), Storages(&ecs->template GetSparseSet<TComponents>()...)
         {
+            (MarkStorageWritten(ecs->template GetSparseSet<TComponents>()), ...);
+
+            if (disabled)
+            {
+                SelectEnabledRows(*disabled);
+            }
         }
 
-        [[nodiscard]] Iterator begin()
+        [[nodiscard]] Iterator begin() const
         {
-            return EntityView::Iterator(ECS, Entities, 0, End);
+            return Iterator(Entities, Rows, Storages, 0);
         }
 
-        [[nodiscard]] Iterator end()
+        [[nodiscard]] Iterator end() const
         {
-            return EntityView::Iterator(ECS, Entities, End, End);
+            return Iterator(Entities, Rows, Storages, static_cast<std::ptrdiff_t>(Count));
         }
 
         [[nodiscard]] ConstIterator cbegin() const
         {
-            return EntityView::Iterator(ECS, Entities, 0, End);
+            return begin();
         }
 
         [[nodiscard]] ConstIterator cend() const
         {
-            return EntityView::Iterator(ECS, Entities, End, End);
+            return end();
+        }
+
+        [[nodiscard]] typename Iterator::reference operator[](SizeType index) const
+        {
+            return begin()[index];
+        }
+
+        [[nodiscard]] SizeType Size() const
+        {
+            return Count;
+        }
+
+        [[nodiscard]] bool Empty() const
+        {
+            return Count == 0;
         }
 
     private:
-        TECS* ECS;
+        void SelectEnabledRows(const std::vector<std::uint64_t>& disabled)
+        {
+            std::shared_ptr<std::vector<SizeType>> rows = std::make_shared<std::vector<SizeType>>();
+
+            rows->reserve(Count);
+
+            for (SizeType word = 0; word * 64 < Count; word++)
+            {
+                std::uint64_t enabled = word < disabled.size() ? ~disabled[word] : ~std::uint64_t(0);
+
+                if (Count - word * 64 < 64)
+                {
+                    enabled &= (std::uint64_t(1) << (Count - word * 64)) - 1;
+                }
+
+                while (enabled)
+                {
+                    rows->push_back(word * 64 + static_cast<SizeType>(std::countr_zero(enabled)));
 
-        SizeType End;
+                    enabled &= enabled - 1;
+                }
+            }
+
+            Count = static_cast<SizeType>(rows->size());
+            Rows = std::move(rows);
+        }
+
+        const EntityType* Entities = nullptr;
+
+        RowsType Rows;
 
-        SparseSet<Entity<SizeType>, SizeType>* Entities;
+        SizeType Count = 0;
+
+        StoragesType Storages;
     };
 }
+
+namespace std::ranges
+{
+    template <typename TECS, typename TSizeType, typename... TComponents>
+    inline constexpr bool enable_borrowed_range<minECS::EntityView<TECS, TSizeType, TComponents...>> = true;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    class EpochManager
+    {
+    public:
+        static constexpr std::size_t SlotCount = 64;
+
+        class Guard
+        {
+        public:
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+
+            inline Guard(Guard&& other) noexcept
+                : Manager(std::exchange(other.Manager, nullptr)), Slot(other.Slot)
+            {
+            }
+
+            inline Guard& operator=(Guard&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    Release();
+
+                    Manager = std::exchange(other.Manager, nullptr);
+                    Slot = other.Slot;
+                }
+
+                return *this;
+            }
+
+            inline ~Guard()
+            {
+                Release();
+            }
+
+        private:
+            friend class EpochManager;
+
+            inline Guard(EpochManager* manager, std::size_t slot)
+                : Manager(manager), Slot(slot)
+            {
+            }
+
+            inline void Release()
+            {
+                if (Manager)
+                {
+                    Manager->Slots[Slot].Epoch.store(0, std::memory_order_release);
+                    Manager = nullptr;
+                }
+            }
+
+            EpochManager* Manager;
+
+            std::size_t Slot;
+        };
+
+        EpochManager() = default;
+
+        inline ~EpochManager()
+        {
+            for (const Retired& retired : RetiredList)
+            {
+                retired.Deleter(retired.Pointer);
+            }
+        }
+
+        EpochManager(const EpochManager&) = delete;
+        EpochManager& operator=(const EpochManager&) = delete;
+
+        [[nodiscard]] inline Guard Enter()
+        {
+            while (true)
+            {
+                for (std::size_t slot = 0; slot < SlotCount; slot++)
+                {
+                    std::uint64_t expected = 0;
+                    std::uint64_t epoch = GlobalEpoch.load(std::memory_order_seq_cst);
+
+                    if (Slots[slot].Epoch.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst))
+                    {
+                        return Guard(this, slot);
+                    }
+                }
+
+                std::this_thread::yield();
+            }
+        }
+
+        inline void Retire(void* pointer, void (*deleter)(void*))
+        {
+            RetiredList.push_back({pointer, deleter, GlobalEpoch.fetch_add(1, std::memory_order_seq_cst)});
+        }
+
+        template <typename T>
+        inline void Retire(const T* pointer)
+        {
+            Retire(const_cast<T*>(pointer), [](void* retired)
+            {
+                delete static_cast<T*>(retired);
+            });
+        }
+
+        inline std::size_t Reclaim()
+        {
+            std::uint64_t oldest = GlobalEpoch.load(std::memory_order_seq_cst);
+
+            for (const Slot& slot : Slots)
+            {
+                std::uint64_t epoch = slot.Epoch.load(std::memory_order_seq_cst);
+
+                if (epoch != 0 && epoch < oldest)
+                {
+                    oldest = epoch;
+                }
+            }
+
+            std::size_t kept = 0;
+            std::size_t reclaimed = 0;
+
+            for (std::size_t i = 0; i < RetiredList.size(); i++)
+            {
+                const Retired& retired = RetiredList[i];
+
+                if (retired.Epoch < oldest)
+                {
+                    retired.Deleter(retired.Pointer);
+                    reclaimed++;
+
+                    continue;
+                }
+
+                RetiredList[kept++] = retired;
+            }
+
+            RetiredList.resize(kept);
+
+            return reclaimed;
+        }
+
+        [[nodiscard]] inline std::size_t GetPendingCount() const
+        {
+            return RetiredList.size();
+        }
+
+        [[nodiscard]] inline std::uint64_t GetEpoch() const
+        {
+            return GlobalEpoch.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct alignas(64) Slot
+        {
+            std::atomic<std::uint64_t> Epoch = 0;
+        };
+
+        struct Retired
+        {
+            void* Pointer;
+            void (*Deleter)(void*);
+
+            std::uint64_t Epoch;
+        };
+
+        std::array<Slot, SlotCount> Slots;
+        std::atomic<std::uint64_t> GlobalEpoch = 1;
+
+        std::vector<Retired> RetiredList;
+    };
+}
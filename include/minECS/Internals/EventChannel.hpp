@@ -0,0 +1,297 @@
+#pragma once
+
+#include <minECS/Internals/Traits.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename TEvent>
+    requires CanBeComponent<TEvent>
+    class EventChannel
+    {
+    private:
+        struct BufferNode
+        {
+            std::vector<TEvent> Events;
+            BufferNode* Next = nullptr;
+        };
+
+    public:
+        using EventType = TEvent;
+
+        class Writer
+        {
+        public:
+            inline ~Writer()
+            {
+                Submit();
+            }
+
+            Writer(const Writer&) = delete;
+            Writer& operator=(const Writer&) = delete;
+
+            inline Writer(Writer&& other) noexcept
+                : Channel(std::exchange(other.Channel, nullptr)), Buffer(std::exchange(other.Buffer, nullptr))
+            {
+            }
+
+            inline Writer& operator=(Writer&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    Submit();
+
+                    Channel = std::exchange(other.Channel, nullptr);
+                    Buffer = std::exchange(other.Buffer, nullptr);
+                }
+
+                return *this;
+            }
+
+            inline void Send(const EventType& event)
+            {
+                Buffer->Events.push_back(event);
+            }
+
+            inline void Send(EventType&& event)
+            {
+                Buffer->Events.push_back(std::move(event));
+            }
+
+            template <typename... TArgs>
+            inline EventType& Emplace(TArgs&&... args)
+            {
+                return Buffer->Events.emplace_back(std::forward<TArgs>(args)...);
+            }
+
+            [[nodiscard]] inline std::size_t Size() const
+            {
+                return Buffer ? Buffer->Events.size() : 0;
+            }
+
+            inline void Submit()
+            {
+                if (!Channel)
+                {
+                    return;
+                }
+
+                Channel->Push(Buffer);
+
+                Channel = nullptr;
+                Buffer = nullptr;
+            }
+
+        private:
+            friend class EventChannel;
+
+            inline Writer(EventChannel* channel, BufferNode* buffer)
+                : Channel(channel), Buffer(buffer)
+            {
+            }
+
+            EventChannel* Channel;
+            BufferNode* Buffer;
+        };
+
+        class Reader
+        {
+        public:
+            Reader() = default;
+
+            template <typename TFunction>
+            inline std::size_t Read(const EventChannel& channel, TFunction&& function, std::size_t budget = std::numeric_limits<std::size_t>::max())
+            {
+                Skip(channel);
+
+                std::size_t count = 0;
+                std::uint64_t end = channel.GetEndSequence();
+
+                while (Next < end && count < budget)
+                {
+                    function(channel.At(Next));
+
+                    Next++;
+                    count++;
+                }
+
+                return count;
+            }
+
+            [[nodiscard]] inline std::size_t GetPendingCount(const EventChannel& channel) const
+            {
+                return static_cast<std::size_t>(channel.GetEndSequence() - std::max(Next, channel.GetFirstSequence()));
+            }
+
+            [[nodiscard]] inline std::uint64_t GetMissedCount() const
+            {
+                return Missed;
+            }
+
+            inline void Reset(const EventChannel& channel)
+            {
+                Next = channel.GetEndSequence();
+            }
+
+        private:
+            friend class EventChannel;
+
+            inline Reader(std::uint64_t next)
+                : Next(next)
+            {
+            }
+
+            inline void Skip(const EventChannel& channel)
+            {
+                std::uint64_t first = channel.GetFirstSequence();
+
+                if (Next < first)
+                {
+                    Missed += first - Next;
+                    Next = first;
+                }
+            }
+
+            std::uint64_t Next = 0;
+            std::uint64_t Missed = 0;
+        };
+
+        EventChannel() = default;
+
+        inline ~EventChannel()
+        {
+            BufferNode* node = Submitted.exchange(nullptr, std::memory_order_acquire);
+
+            while (node)
+            {
+                delete std::exchange(node, node->Next);
+            }
+
+            for (BufferNode* recycled : Recycled)
+            {
+                delete recycled;
+            }
+        }
+
+        EventChannel(const EventChannel&) = delete;
+        EventChannel& operator=(const EventChannel&) = delete;
+
+        [[nodiscard]] inline Writer MakeWriter()
+        {
+            std::size_t index = RecycledTaken.fetch_add(1, std::memory_order_relaxed);
+
+            return Writer(this, index < Recycled.size() ? Recycled[index] : new BufferNode());
+        }
+
+        [[nodiscard]] inline Reader MakeReader() const
+        {
+            return Reader(GetFirstSequence());
+        }
+
+        inline void Send(const EventType& event)
+        {
+            Writer writer = MakeWriter();
+
+            writer.Send(event);
+        }
+
+        inline void Update()
+        {
+            BufferNode* node = Submitted.exchange(nullptr, std::memory_order_acquire);
+            BufferNode* ordered = nullptr;
+
+            Recycled.erase(Recycled.begin(), Recycled.begin() + std::min(RecycledTaken.load(std::memory_order_relaxed), Recycled.size()));
+            RecycledTaken.store(0, std::memory_order_relaxed);
+
+            PreviousStart += Previous.size();
+
+            Previous.swap(Current);
+            Current.clear();
+
+            while (node)
+            {
+                BufferNode* next = node->Next;
+
+                node->Next = ordered;
+                ordered = node;
+                node = next;
+            }
+
+            while (ordered)
+            {
+                Current.insert(Current.end(), std::make_move_iterator(ordered->Events.begin()), std::make_move_iterator(ordered->Events.end()));
+
+                ordered->Events.clear();
+                Recycled.push_back(std::exchange(ordered, ordered->Next));
+            }
+        }
+
+        inline void Clear()
+        {
+            PreviousStart += Previous.size() + Current.size();
+
+            Previous.clear();
+            Current.clear();
+        }
+
+        [[nodiscard]] inline std::uint64_t GetFirstSequence() const
+        {
+            return PreviousStart;
+        }
+
+        [[nodiscard]] inline std::uint64_t GetEndSequence() const
+        {
+            return PreviousStart + Previous.size() + Current.size();
+        }
+
+        [[nodiscard]] inline std::size_t Size() const
+        {
+            return Previous.size() + Current.size();
+        }
+
+        [[nodiscard]] inline bool Empty() const
+        {
+            return Previous.empty() && Current.empty();
+        }
+
+        [[nodiscard]] inline std::size_t GetRecycledCount() const
+        {
+            return Recycled.size();
+        }
+
+    private:
+        [[nodiscard]] inline const EventType& At(std::uint64_t sequence) const
+        {
+            std::size_t offset = static_cast<std::size_t>(sequence - PreviousStart);
+
+            return offset < Previous.size() ? Previous[offset] : Current[offset - Previous.size()];
+        }
+
+        inline void Push(BufferNode* node)
+        {
+            node->Next = Submitted.load(std::memory_order_relaxed);
+
+            while (!Submitted.compare_exchange_weak(node->Next, node, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        std::vector<EventType> Previous;
+        std::vector<EventType> Current;
+
+        std::uint64_t PreviousStart = 0;
+
+        std::atomic<BufferNode*> Submitted = nullptr;
+
+        std::vector<BufferNode*> Recycled;
+        std::atomic<std::size_t> RecycledTaken = 0;
+    };
+}
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/SparseSet.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class Hierarchy
+    {
+    public:
+        using SizeType = TSizeType;
+
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
+
+        struct Relationship
+        {
+            SizeType Parent = DeadIndex;
+            SizeType FirstChild = DeadIndex;
+            SizeType NextSibling = DeadIndex;
+            SizeType PreviousSibling = DeadIndex;
+        };
+
+        class ChildIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = SizeType;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const SizeType*;
+            using reference = const SizeType&;
+
+            ChildIterator() = default;
+
+            ChildIterator(const SparseSet<Relationship, SizeType>* relationships, SizeType current)
+                : Relationships(relationships), Current(current)
+            {
+            }
+
+            reference operator*() const
+            {
+                return Current;
+            }
+
+            ChildIterator& operator++()
+            {
+                Current = Relationships->Get(Current).GetValue().NextSibling;
+
+                return *this;
+            }
+
+            ChildIterator operator++(int)
+            {
+                ChildIterator previous = *this;
+
+                ++*this;
+
+                return previous;
+            }
+
+            bool operator==(const ChildIterator& other) const
+            {
+                return Current == other.Current;
+            }
+
+            bool operator!=(const ChildIterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            const SparseSet<Relationship, SizeType>* Relationships = nullptr;
+
+            SizeType Current = DeadIndex;
+        };
+
+        class ChildRange
+        {
+        public:
+            ChildRange(const SparseSet<Relationship, SizeType>* relationships, SizeType first)
+                : Relationships(relationships), First(first)
+            {
+            }
+
+            [[nodiscard]] ChildIterator begin() const
+            {
+                return ChildIterator(Relationships, First);
+            }
+
+            [[nodiscard]] ChildIterator end() const
+            {
+                return ChildIterator(Relationships, DeadIndex);
+            }
+
+            [[nodiscard]] bool Empty() const
+            {
+                return First == DeadIndex;
+            }
+
+        private:
+            const SparseSet<Relationship, SizeType>* Relationships;
+
+            SizeType First;
+        };
+
+        [[nodiscard]] inline bool SetParent(SizeType child, SizeType parent)
+        {
+            if (child == parent || child == DeadIndex || parent == DeadIndex)
+            {
+                return false;
+            }
+
+            for (SizeType ancestor = parent; ancestor != DeadIndex; ancestor = GetParentIndex(ancestor))
+            {
+                if (ancestor == child)
+                {
+                    return false;
+                }
+            }
+
+            static_cast<void>(Relationships.Insert(child, Relationship{}));
+            static_cast<void>(Relationships.Insert(parent, Relationship{}));
+
+            Detach(child);
+
+            Relationship& childRelationship = Relationships.Get(child).GetValue();
+            Relationship& parentRelationship = Relationships.Get(parent).GetValue();
+
+            childRelationship.Parent = parent;
+            childRelationship.NextSibling = parentRelationship.FirstChild;
+
+            if (parentRelationship.FirstChild != DeadIndex)
+            {
+                Relationships.Get(parentRelationship.FirstChild).GetValue().PreviousSibling = child;
+            }
+
+            parentRelationship.FirstChild = child;
+
+            Dirty = true;
+
+            return true;
+        }
+
+        [[nodiscard]] inline bool RemoveParent(SizeType child)
+        {
+            if (GetParentIndex(child) == DeadIndex)
+            {
+                return false;
+            }
+
+            Detach(child);
+
+            Dirty = true;
+
+            return true;
+        }
+
+        inline void Remove(SizeType index)
+        {
+            ReferenceResult<Relationship> result = Relationships.Get(index);
+
+            if (result.Failed())
+            {
+                return;
+            }
+
+            Detach(index);
+
+            SizeType child = result.GetValue().FirstChild;
+
+            while (child != DeadIndex)
+            {
+                Relationship& childRelationship = Relationships.Get(child).GetValue();
+                SizeType next = childRelationship.NextSibling;
+
+                childRelationship.Parent = DeadIndex;
+                childRelationship.NextSibling = DeadIndex;
+                childRelationship.PreviousSibling = DeadIndex;
+
+                child = next;
+            }
+
+            static_cast<void>(Relationships.Remove(index));
+
+            Dirty = true;
+        }
+
+        [[nodiscard]] inline bool Contains(SizeType index) const
+        {
+            return Relationships.Contains(index);
+        }
+
+        [[nodiscard]] inline SizeType GetParentIndex(SizeType index) const
+        {
+            ReferenceResult<const Relationship> result = Relationships.Get(index);
+
+            return result.Failed() ? DeadIndex : result.GetValue().Parent;
+        }
+
+        [[nodiscard]] inline ChildRange GetChildren(SizeType index) const
+        {
+            ReferenceResult<const Relationship> result = Relationships.Get(index);
+
+            return ChildRange(&Relationships, result.Failed() ? DeadIndex : result.GetValue().FirstChild);
+        }
+
+        [[nodiscard]] inline const std::vector<SizeType>& GetOrder()
+        {
+            if (Dirty)
+            {
+                RebuildOrder();
+            }
+
+            return Order;
+        }
+
+        [[nodiscard]] inline const SparseSet<Relationship, SizeType>& GetRelationships() const
+        {
+            return Relationships;
+        }
+
+        inline void Assign(SparseSet<Relationship, SizeType>&& relationships)
+        {
+            Relationships = std::move(relationships);
+            Order.clear();
+
+            Dirty = true;
+        }
+
+        inline void Clear()
+        {
+            Relationships.Clear();
+            Order.clear();
+
+            Dirty = false;
+        }
+
+    private:
+        inline void Detach(SizeType child)
+        {
+            Relationship& relationship = Relationships.Get(child).GetValue();
+
+            if (relationship.Parent == DeadIndex)
+            {
+                return;
+            }
+
+            if (relationship.PreviousSibling != DeadIndex)
+            {
+                Relationships.Get(relationship.PreviousSibling).GetValue().NextSibling = relationship.NextSibling;
+            }
+            else
+            {
+                Relationships.Get(relationship.Parent).GetValue().FirstChild = relationship.NextSibling;
+            }
+
+            if (relationship.NextSibling != DeadIndex)
+            {
+                Relationships.Get(relationship.NextSibling).GetValue().PreviousSibling = relationship.PreviousSibling;
+            }
+
+            relationship.Parent = DeadIndex;
+            relationship.NextSibling = DeadIndex;
+            relationship.PreviousSibling = DeadIndex;
+        }
+
+        inline void RebuildOrder()
+        {
+            const auto& dense = Relationships.GetDense();
+            const auto& reverseMapping = Relationships.GetReverseMapping();
+
+            Order.clear();
+            Order.reserve(dense.size());
+
+            for (SizeType i = 0; i < dense.size(); i++)
+            {
+                if (dense[i].Parent == DeadIndex)
+                {
+                    Order.push_back(reverseMapping[i]);
+                }
+            }
+
+            for (SizeType i = 0; i < Order.size(); i++)
+            {
+                SizeType child = Relationships.Get(Order[i]).GetValue().FirstChild;
+
+                while (child != DeadIndex)
+                {
+                    Order.push_back(child);
+
+                    child = Relationships.Get(child).GetValue().NextSibling;
+                }
+            }
+
+            Dirty = false;
+        }
+
+        SparseSet<Relationship, SizeType> Relationships;
+
+        std::vector<SizeType> Order;
+
+        bool Dirty = false;
+    };
+}
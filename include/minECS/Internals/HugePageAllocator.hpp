@@ -0,0 +1,72 @@
+#pragma once
+
+#include <minECS/Internals/Traits.hpp>
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace minECS
+{
+    template <typename T>
+    class HugePageAllocator
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        static constexpr std::size_t HugePageSize = std::size_t(2) << 20;
+
+        HugePageAllocator() noexcept = default;
+
+        template <typename U>
+        HugePageAllocator(const HugePageAllocator<U>&) noexcept
+        {
+        }
+
+        [[nodiscard]] inline T* allocate(std::size_t count)
+        {
+            std::size_t bytes = count * sizeof(T);
+
+            if (bytes < HugePageSize)
+            {
+                return static_cast<T*>(::operator new(bytes, std::align_val_t(alignof(T))));
+            }
+
+            std::size_t rounded = (bytes + HugePageSize - 1) / HugePageSize * HugePageSize;
+            void* pointer = ::operator new(rounded, std::align_val_t(HugePageSize));
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            madvise(pointer, rounded, MADV_HUGEPAGE);
+#endif
+
+            return static_cast<T*>(pointer);
+        }
+
+        inline void deallocate(T* pointer, std::size_t count) noexcept
+        {
+            std::size_t bytes = count * sizeof(T);
+
+            if (bytes < HugePageSize)
+            {
+                ::operator delete(pointer, std::align_val_t(alignof(T)));
+
+                return;
+            }
+
+            ::operator delete(pointer, std::align_val_t(HugePageSize));
+        }
+
+        template <typename U>
+        [[nodiscard]] friend inline bool operator==(const HugePageAllocator&, const HugePageAllocator<U>&) noexcept
+        {
+            return true;
+        }
+    };
+}
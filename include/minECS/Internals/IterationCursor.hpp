@@ -0,0 +1,156 @@
+#pragma once
+
+#include <minECS/Internals/Entity.hpp>
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <array>
+#include <chrono>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace minECS
+{
+    template <typename TECS, typename... TComponents>
+    requires IsECS<TECS> && ComponentsAreUnique<TComponents...> && (TECS::DescriptorType::template Contains<TComponents> && ...) && (sizeof...(TComponents) != 0)
+    class IterationCursor
+    {
+    public:
+        using SizeType = typename TECS::SizeType;
+        using EntityType = Entity<SizeType>;
+        using ClockType = std::chrono::steady_clock;
+
+        static constexpr SizeType ClockCheckInterval = 32;
+
+        IterationCursor(bool includeDisabled = false)
+            : IncludeDisabled(includeDisabled)
+        {
+        }
+
+        template <typename TFunction>
+        inline bool Step(TECS& ecs, SizeType count, TFunction&& function)
+        {
+            return StepImplementation(ecs, count, ClockType::time_point::max(), function);
+        }
+
+        template <typename TRep, typename TPeriod, typename TFunction>
+        inline bool Step(TECS& ecs, std::chrono::duration<TRep, TPeriod> budget, TFunction&& function)
+        {
+            return StepImplementation(ecs, std::numeric_limits<SizeType>::max(), ClockType::now() + budget, function);
+        }
+
+        inline void Reset()
+        {
+            Position = 0;
+        }
+
+        [[nodiscard]] inline SizeType GetPosition() const
+        {
+            return Position;
+        }
+
+        [[nodiscard]] inline SizeType GetPassCount() const
+        {
+            return PassCount;
+        }
+
+    private:
+        template <typename TFunction>
+        inline bool StepImplementation(TECS& ecs, SizeType count, ClockType::time_point deadline, TFunction& function)
+        {
+            (MarkStorageWritten(ecs.template GetSparseSet<TComponents>()), ...);
+
+            if (Position == 0)
+            {
+                SelectDriver(ecs);
+            }
+
+            if (!DriveImplementation(ecs, count, deadline, function, std::index_sequence_for<TComponents...>{}))
+            {
+                return false;
+            }
+
+            Position = 0;
+            PassCount++;
+
+            return true;
+        }
+
+        inline void SelectDriver(TECS& ecs)
+        {
+            std::array<SizeType, sizeof...(TComponents)> sizes = {ecs.template GetSparseSet<TComponents>().Size()...};
+
+            Driver = 0;
+
+            for (SizeType i = 1; i < sizes.size(); i++)
+            {
+                if (sizes[i] < sizes[Driver])
+                {
+                    Driver = i;
+                }
+            }
+        }
+
+        template <typename TFunction, std::size_t... Ns>
+        inline bool DriveImplementation(TECS& ecs, SizeType count, ClockType::time_point deadline, TFunction& function, std::index_sequence<Ns...>)
+        {
+            bool finished = false;
+
+            ((Driver == Ns ? static_cast<void>(finished = Drive<Ns>(ecs, count, deadline, function)) : void()), ...);
+
+            return finished;
+        }
+
+        template <std::size_t N, typename TFunction>
+        inline bool Drive(TECS& ecs, SizeType count, ClockType::time_point deadline, TFunction& function)
+        {
+            using DriverType = std::tuple_element_t<N, std::tuple<TComponents...>>;
+            using StorageType = typename TECS::template StorageType<DriverType>;
+
+            const StorageType& storage = ecs.template GetSparseSet<DriverType>();
+
+            SizeType processed = 0;
+            SizeType visited = 0;
+
+            while (Position < ecs.GetEntitySlotCount())
+            {
+                if (processed >= count)
+                {
+                    return false;
+                }
+
+                if (++visited % ClockCheckInterval == 0 && ClockType::now() >= deadline)
+                {
+                    return false;
+                }
+
+                SizeType id = Position++;
+
+                if (!storage.Contains(id))
+                {
+                    continue;
+                }
+
+                ValueResult<EntityType> entity = ecs.GetEntity(id);
+
+                if (!entity.Succeeded() || !ecs.template EntityHasComponents<TComponents...>(entity.GetValue()) || (!IncludeDisabled && !ecs.IsEntityEnabled(entity.GetValue())))
+                {
+                    continue;
+                }
+
+                function(entity.GetValue(), ecs.template GetSparseSet<TComponents>().GetUnchecked(id)...);
+
+                processed++;
+            }
+
+            return true;
+        }
+
+        SizeType Position = 0;
+        SizeType PassCount = 0;
+        SizeType Driver = 0;
+
+        bool IncludeDisabled = false;
+    };
+}
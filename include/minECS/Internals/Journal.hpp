@@ -0,0 +1,249 @@
+#pragma once
+
+#include <minECS/Internals/Traits.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class Journal
+    {
+    public:
+        using SizeType = TSizeType;
+
+        enum class Operation : std::uint8_t
+        {
+            Create,
+            Destroy,
+            Add,
+            Remove,
+            Write,
+            Clear,
+            Reserve,
+            Free,
+        };
+
+        struct Record
+        {
+            Operation Type;
+            std::uint8_t Reserved;
+            std::uint16_t Component;
+            std::uint32_t Size;
+            SizeType ID;
+            SizeType Generation;
+        };
+
+        inline Journal(std::size_t capacity = 1 << 16)
+        {
+            Buffer.resize(capacity < sizeof(Record) ? sizeof(Record) : capacity);
+        }
+
+        inline ~Journal()
+        {
+            Close();
+        }
+
+        Journal(const Journal&) = delete;
+        Journal& operator=(const Journal&) = delete;
+
+        inline Journal(Journal&& other) noexcept
+            : Buffer(std::move(other.Buffer)), File(std::exchange(other.File, nullptr)), Used(std::exchange(other.Used, 0)), Pending(std::exchange(other.Pending, 0)), FlushRecords(other.FlushRecords), FlushInterval(other.FlushInterval), LastFlush(other.LastFlush)
+        {
+        }
+
+        inline Journal& operator=(Journal&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Close();
+
+                Buffer = std::move(other.Buffer);
+                File = std::exchange(other.File, nullptr);
+                Used = std::exchange(other.Used, 0);
+                Pending = std::exchange(other.Pending, 0);
+                FlushRecords = other.FlushRecords;
+                FlushInterval = other.FlushInterval;
+                LastFlush = other.LastFlush;
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] inline bool Open(const std::string& path, bool append = false)
+        {
+            Close();
+
+            File = std::fopen(path.c_str(), append ? "ab" : "wb");
+
+            if (!File)
+            {
+                std::cerr << "Failed to open journal " << path << "\n";
+
+                return false;
+            }
+
+            return true;
+        }
+
+        inline void Close()
+        {
+            if (!File)
+            {
+                return;
+            }
+
+            Flush();
+
+            std::fclose(File);
+
+            File = nullptr;
+        }
+
+        [[nodiscard]] inline bool IsOpen() const
+        {
+            return File != nullptr;
+        }
+
+        inline void Append(Operation type, std::uint16_t component, SizeType id, SizeType generation, const void* payload = nullptr, std::uint32_t size = 0)
+        {
+            if (!File)
+            {
+                return;
+            }
+
+            Record record{type, 0, component, size, id, generation};
+
+            std::size_t total = sizeof(Record) + size;
+
+            if (Used + total > Buffer.size())
+            {
+                Flush();
+            }
+
+            if (total > Buffer.size())
+            {
+                std::fwrite(&record, sizeof(Record), 1, File);
+
+                if (size != 0)
+                {
+                    std::fwrite(payload, 1, size, File);
+                }
+
+                std::fflush(File);
+
+                LastFlush = std::chrono::steady_clock::now();
+
+                return;
+            }
+
+            std::memcpy(Buffer.data() + Used, &record, sizeof(Record));
+
+            if (size != 0)
+            {
+                std::memcpy(Buffer.data() + Used + sizeof(Record), payload, size);
+            }
+
+            Used += total;
+            Pending++;
+
+            if (Pending >= FlushRecords || std::chrono::steady_clock::now() - LastFlush >= FlushInterval)
+            {
+                Flush();
+            }
+        }
+
+        inline void SetFlushPolicy(std::size_t records, std::chrono::milliseconds interval)
+        {
+            FlushRecords = records == 0 ? 1 : records;
+            FlushInterval = interval;
+        }
+
+        inline void Flush()
+        {
+            if (File && Used != 0)
+            {
+                std::fwrite(Buffer.data(), 1, Used, File);
+                std::fflush(File);
+            }
+
+            Used = 0;
+            Pending = 0;
+            LastFlush = std::chrono::steady_clock::now();
+        }
+
+        template <typename TFunction>
+        [[nodiscard]] static inline bool Read(const std::string& path, TFunction&& function)
+        {
+            std::FILE* file = std::fopen(path.c_str(), "rb");
+
+            if (!file)
+            {
+                std::cerr << "Failed to open journal " << path << "\n";
+
+                return false;
+            }
+
+            std::vector<std::byte> data;
+            std::size_t size = 0;
+
+            data.resize(1 << 16);
+
+            while (true)
+            {
+                std::size_t read = std::fread(data.data() + size, 1, data.size() - size, file);
+
+                size += read;
+
+                if (size < data.size())
+                {
+                    break;
+                }
+
+                data.resize(data.size() * 2);
+            }
+
+            std::fclose(file);
+
+            std::size_t offset = 0;
+
+            while (offset + sizeof(Record) <= size)
+            {
+                Record record;
+
+                std::memcpy(&record, data.data() + offset, sizeof(Record));
+
+                if (offset + sizeof(Record) + record.Size > size)
+                {
+                    break;
+                }
+
+                function(record, data.data() + offset + sizeof(Record));
+
+                offset += sizeof(Record) + record.Size;
+            }
+
+            return true;
+        }
+
+    private:
+        std::vector<std::byte> Buffer;
+
+        std::FILE* File = nullptr;
+        std::size_t Used = 0;
+        std::size_t Pending = 0;
+        std::size_t FlushRecords = 1024;
+
+        std::chrono::milliseconds FlushInterval{100};
+        std::chrono::steady_clock::time_point LastFlush = std::chrono::steady_clock::now();
+    };
+}
@@ -0,0 +1,393 @@
+#pragma once
+
+#include <minECS/Internals/Traits.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace minECS
+{
+    class MappedStorage
+    {
+    public:
+        MappedStorage() = delete;
+
+        static inline void SetDirectory(const std::string& directory)
+        {
+            Directory() = directory;
+        }
+
+        [[nodiscard]] static inline const std::string& GetDirectory()
+        {
+            return Directory();
+        }
+
+    private:
+        static inline std::string& Directory()
+        {
+            static std::string directory = std::filesystem::temp_directory_path().string();
+
+            return directory;
+        }
+    };
+
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    class MappedVector
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        MappedVector() = default;
+
+        inline ~MappedVector()
+        {
+            Release();
+        }
+
+        MappedVector(const MappedVector&) = delete;
+        MappedVector& operator=(const MappedVector&) = delete;
+
+        inline MappedVector(MappedVector&& other) noexcept
+            : Data(std::exchange(other.Data, nullptr)), Count(std::exchange(other.Count, 0)), Capacity(std::exchange(other.Capacity, 0)),
+              Bytes(std::exchange(other.Bytes, 0)), Descriptor(std::exchange(other.Descriptor, -1))
+        {
+        }
+
+        inline MappedVector& operator=(MappedVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Release();
+
+                Data = std::exchange(other.Data, nullptr);
+                Count = std::exchange(other.Count, 0);
+                Capacity = std::exchange(other.Capacity, 0);
+                Bytes = std::exchange(other.Bytes, 0);
+                Descriptor = std::exchange(other.Descriptor, -1);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] inline T& operator[](std::size_t index)
+        {
+            return Data[index];
+        }
+
+        [[nodiscard]] inline const T& operator[](std::size_t index) const
+        {
+            return Data[index];
+        }
+
+        [[nodiscard]] inline T& back()
+        {
+            return Data[Count - 1];
+        }
+
+        [[nodiscard]] inline const T& back() const
+        {
+            return Data[Count - 1];
+        }
+
+        [[nodiscard]] inline T* data() noexcept
+        {
+            return Data;
+        }
+
+        [[nodiscard]] inline const T* data() const noexcept
+        {
+            return Data;
+        }
+
+        [[nodiscard]] inline iterator begin() noexcept
+        {
+            return Data;
+        }
+
+        [[nodiscard]] inline const_iterator begin() const noexcept
+        {
+            return Data;
+        }
+
+        [[nodiscard]] inline iterator end() noexcept
+        {
+            return Data + Count;
+        }
+
+        [[nodiscard]] inline const_iterator end() const noexcept
+        {
+            return Data + Count;
+        }
+
+        [[nodiscard]] inline const_iterator cbegin() const noexcept
+        {
+            return Data;
+        }
+
+        [[nodiscard]] inline const_iterator cend() const noexcept
+        {
+            return Data + Count;
+        }
+
+        [[nodiscard]] inline std::size_t size() const noexcept
+        {
+            return Count;
+        }
+
+        [[nodiscard]] inline std::size_t capacity() const noexcept
+        {
+            return Capacity;
+        }
+
+        [[nodiscard]] inline bool empty() const noexcept
+        {
+            return Count == 0;
+        }
+
+        template <typename... TArgs>
+        inline T& emplace_back(TArgs&&... args)
+        {
+            if (Count == Capacity)
+            {
+                T value(std::forward<TArgs>(args)...);
+
+                Remap(Capacity * 2 > MinimumCapacity() ? Capacity * 2 : MinimumCapacity());
+
+                return *new (Data + Count++) T(value);
+            }
+
+            return *new (Data + Count++) T(std::forward<TArgs>(args)...);
+        }
+
+        inline void push_back(const T& element)
+        {
+            emplace_back(element);
+        }
+
+        inline void pop_back()
+        {
+            Count--;
+        }
+
+        inline iterator insert(const_iterator position, std::size_t count, const T& element)
+        {
+            std::size_t offset = static_cast<std::size_t>(position - Data);
+            T value = element;
+
+            reserve(Count + count);
+
+            std::memmove(static_cast<void*>(Data + offset + count), Data + offset, (Count - offset) * sizeof(T));
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                new (Data + offset + i) T(value);
+            }
+
+            Count += count;
+
+            return Data + offset;
+        }
+
+        template <typename TIterator>
+        requires std::input_iterator<TIterator>
+        inline iterator insert(const_iterator position, TIterator first, TIterator last)
+        {
+            std::size_t offset = static_cast<std::size_t>(position - Data);
+
+            if constexpr (std::forward_iterator<TIterator>)
+            {
+                reserve(Count + static_cast<std::size_t>(std::distance(first, last)));
+            }
+
+            std::size_t previous = Count;
+
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+
+            std::rotate(Data + offset, Data + previous, Data + Count);
+
+            return Data + offset;
+        }
+
+        inline void resize(std::size_t count)
+        {
+            reserve(count);
+
+            for (; Count < count; Count++)
+            {
+                new (Data + Count) T();
+            }
+
+            Count = count;
+        }
+
+        inline void reserve(std::size_t capacity)
+        {
+            if (capacity > Capacity)
+            {
+                Remap(capacity > Capacity * 2 ? capacity : Capacity * 2);
+            }
+        }
+
+        inline void shrink_to_fit()
+        {
+            if (Count == 0)
+            {
+                Release();
+
+                return;
+            }
+
+            if (RoundToPage(Count * sizeof(T)) < Bytes)
+            {
+                Remap(Count);
+            }
+        }
+
+        inline void clear() noexcept
+        {
+            Count = 0;
+        }
+
+        inline void swap(MappedVector& other) noexcept
+        {
+            std::swap(Data, other.Data);
+            std::swap(Count, other.Count);
+            std::swap(Capacity, other.Capacity);
+            std::swap(Bytes, other.Bytes);
+            std::swap(Descriptor, other.Descriptor);
+        }
+
+    private:
+        [[nodiscard]] static inline std::size_t PageBytes()
+        {
+            static const std::size_t pageBytes = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+            return pageBytes;
+        }
+
+        [[nodiscard]] static inline std::size_t RoundToPage(std::size_t bytes)
+        {
+            return (bytes + PageBytes() - 1) / PageBytes() * PageBytes();
+        }
+
+        [[nodiscard]] static inline std::size_t MinimumCapacity()
+        {
+            return PageBytes() / sizeof(T) > 0 ? PageBytes() / sizeof(T) : 1;
+        }
+
+        inline void Remap(std::size_t capacity)
+        {
+            std::size_t bytes = RoundToPage(capacity * sizeof(T));
+
+            if (Descriptor < 0)
+            {
+                std::string path = MappedStorage::GetDirectory() + "/minECS-XXXXXX";
+
+                Descriptor = mkstemp(path.data());
+
+                if (Descriptor < 0)
+                {
+                    std::cerr << "Failed to create mapped storage in " << MappedStorage::GetDirectory() << "\n";
+
+                    throw std::bad_alloc();
+                }
+
+                unlink(path.c_str());
+            }
+
+            if (ftruncate(Descriptor, static_cast<off_t>(bytes)) != 0)
+            {
+                std::cerr << "Failed to resize mapped storage to " << bytes << " bytes\n";
+
+                throw std::bad_alloc();
+            }
+
+            void* mapping = MAP_FAILED;
+
+#if defined(__linux__)
+            if (Data)
+            {
+                mapping = mremap(Data, Bytes, bytes, MREMAP_MAYMOVE);
+            }
+            else
+            {
+                mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+            }
+#else
+            mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+
+            if (Data && mapping != MAP_FAILED)
+            {
+                munmap(Data, Bytes);
+            }
+#endif
+
+            if (mapping == MAP_FAILED)
+            {
+                std::cerr << "Failed to map " << bytes << " bytes of storage\n";
+
+                throw std::bad_alloc();
+            }
+
+            madvise(mapping, bytes, MADV_SEQUENTIAL);
+
+            Data = static_cast<T*>(mapping);
+            Bytes = bytes;
+            Capacity = bytes / sizeof(T);
+        }
+
+        inline void Release() noexcept
+        {
+            if (Data)
+            {
+                munmap(Data, Bytes);
+            }
+
+            if (Descriptor >= 0)
+            {
+                close(Descriptor);
+            }
+
+            Data = nullptr;
+            Count = 0;
+            Capacity = 0;
+            Bytes = 0;
+            Descriptor = -1;
+        }
+
+        T* Data = nullptr;
+
+        std::size_t Count = 0;
+        std::size_t Capacity = 0;
+        std::size_t Bytes = 0;
+
+        int Descriptor = -1;
+    };
+}
+
+#endif
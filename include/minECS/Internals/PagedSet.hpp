@@ -0,0 +1,338 @@
+#pragma once
+
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename T, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class PagedSet
+    {
+    public:
+        using Type = T;
+        using SizeType = TSizeType;
+
+        using Iterator = typename std::vector<Type>::iterator;
+        using ConstIterator = typename std::vector<Type>::const_iterator;
+
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
+        static constexpr SizeType PageSize = 256;
+
+        inline PagedSet() = default;
+        inline ~PagedSet() = default;
+
+        PagedSet(const PagedSet&) = delete;
+        PagedSet& operator=(const PagedSet&) = delete;
+
+        inline PagedSet(PagedSet&&) noexcept = default;
+        inline PagedSet& operator=(PagedSet&&) noexcept = default;
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, const Type& element)
+        {
+            return Emplace(index, element);
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, Type&& element)
+        {
+            return Emplace(index, std::move(element));
+        }
+
+        template <typename... TArgs>
+        [[nodiscard]] inline ReferenceResult<Type> Emplace(SizeType index, TArgs&&... args)
+        {
+            SizeType& slot = Slot(index);
+
+            if (slot != DeadIndex)
+            {
+                return ReferenceResult<Type>(&Dense[slot], false);
+            }
+
+            slot = Dense.size();
+
+            Dense.emplace_back(std::forward<TArgs>(args)...);
+            ReverseMapping.push_back(index);
+
+            return ReferenceResult<Type>(&Dense[slot], true);
+        }
+
+        inline void Fill(const std::vector<SizeType>& indices, const Type& element)
+        {
+            Type value = element;
+
+            Dense.reserve(Dense.size() + indices.size());
+            ReverseMapping.reserve(ReverseMapping.size() + indices.size());
+
+            for (const SizeType& index : indices)
+            {
+                static_cast<void>(Emplace(index, value));
+            }
+        }
+
+        template <typename TRemap>
+        inline void Merge(PagedSet& other, TRemap&& remap)
+        {
+            Dense.reserve(Dense.size() + other.Dense.size());
+            ReverseMapping.reserve(ReverseMapping.size() + other.Dense.size());
+
+            other.ForEach([this, &remap](SizeType index, Type& element)
+            {
+                static_cast<void>(Emplace(remap(index), std::move(element)));
+            });
+
+            other.Clear();
+        }
+
+        [[nodiscard]] inline bool Remove(SizeType index)
+        {
+            if (!Contains(index))
+            {
+                return false;
+            }
+
+            SizeType& slot = Slot(index);
+            SizeType lastIndex = static_cast<SizeType>(Dense.size() - 1);
+
+            if (slot != lastIndex)
+            {
+                SizeType lastEntity = ReverseMapping[lastIndex];
+
+                Dense[slot] = std::move(Dense[lastIndex]);
+                ReverseMapping[slot] = lastEntity;
+                Slot(lastEntity) = slot;
+            }
+
+            slot = DeadIndex;
+
+            Dense.pop_back();
+            ReverseMapping.pop_back();
+
+            return true;
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Get(SizeType index)
+        {
+            if (!Contains(index))
+            {
+                return ReferenceResult<Type>(nullptr, false);
+            }
+
+            return ReferenceResult<Type>(&GetUnchecked(index), true);
+        }
+
+        [[nodiscard]] inline ReferenceResult<const Type> Get(SizeType index) const
+        {
+            if (!Contains(index))
+            {
+                return ReferenceResult<const Type>(nullptr, false);
+            }
+
+            return ReferenceResult<const Type>(&GetUnchecked(index), true);
+        }
+
+        [[nodiscard]] inline Type& GetUnchecked(SizeType index)
+        {
+            return Dense[(*Pages[index / PageSize])[index % PageSize]];
+        }
+
+        [[nodiscard]] inline const Type& GetUnchecked(SizeType index) const
+        {
+            return Dense[(*Pages[index / PageSize])[index % PageSize]];
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function)
+        {
+            for (SizeType i = 0; i < Dense.size(); i++)
+            {
+                function(ReverseMapping[i], Dense[i]);
+            }
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function) const
+        {
+            for (SizeType i = 0; i < Dense.size(); i++)
+            {
+                function(ReverseMapping[i], Dense[i]);
+            }
+        }
+
+        [[nodiscard]] inline bool Contains(SizeType index) const
+        {
+            SizeType page = index / PageSize;
+
+            return page < Pages.size() && Pages[page] && (*Pages[page])[index % PageSize] != DeadIndex;
+        }
+
+        [[nodiscard]] inline Iterator begin() noexcept
+        {
+            return Dense.begin();
+        }
+
+        [[nodiscard]] inline ConstIterator begin() const noexcept
+        {
+            return Dense.begin();
+        }
+
+        [[nodiscard]] inline Iterator end() noexcept
+        {
+            return Dense.end();
+        }
+
+        [[nodiscard]] inline ConstIterator end() const noexcept
+        {
+            return Dense.end();
+        }
+
+        [[nodiscard]] inline std::vector<Type>& GetDense()
+        {
+            return Dense;
+        }
+
+        [[nodiscard]] inline const std::vector<Type>& GetDense() const
+        {
+            return Dense;
+        }
+
+        [[nodiscard]] inline const std::vector<SizeType>& GetReverseMapping() const
+        {
+            return ReverseMapping;
+        }
+
+        [[nodiscard]] inline SizeType Size() const
+        {
+            return Dense.size();
+        }
+
+        [[nodiscard]] inline bool Empty() const
+        {
+            return Dense.empty();
+        }
+
+        inline void Clear()
+        {
+            Dense.clear();
+            ReverseMapping.clear();
+            Pages.clear();
+        }
+
+        inline void Arrange(const std::vector<SizeType>& order)
+        {
+            SizeType next = 0;
+
+            for (const SizeType& index : order)
+            {
+                if (!Contains(index))
+                {
+                    continue;
+                }
+
+                SizeType current = Slot(index);
+
+                if (current != next)
+                {
+                    SizeType displaced = ReverseMapping[next];
+
+                    std::swap(Dense[current], Dense[next]);
+                    std::swap(ReverseMapping[current], ReverseMapping[next]);
+
+                    Slot(displaced) = current;
+                    Slot(index) = next;
+                }
+
+                next++;
+            }
+        }
+
+        inline void Reserve(SizeType count)
+        {
+            Dense.reserve(count);
+            ReverseMapping.reserve(count);
+        }
+
+        inline void ShrinkToFit()
+        {
+            Dense.shrink_to_fit();
+            ReverseMapping.shrink_to_fit();
+            Pages.shrink_to_fit();
+        }
+
+        inline void Trim()
+        {
+            std::vector<SizeType> counts(Pages.size(), 0);
+
+            for (const SizeType& index : ReverseMapping)
+            {
+                counts[index / PageSize]++;
+            }
+
+            for (SizeType page = 0; page < Pages.size(); page++)
+            {
+                if (counts[page] == 0)
+                {
+                    Pages[page].reset();
+                }
+            }
+
+            while (!Pages.empty() && !Pages.back())
+            {
+                Pages.pop_back();
+            }
+
+            if (Dense.capacity() > MinimumCapacity && Dense.size() * ShrinkFactor < Dense.capacity())
+            {
+                Dense.shrink_to_fit();
+                ReverseMapping.shrink_to_fit();
+            }
+        }
+
+        [[nodiscard]] inline std::size_t MemoryUsage() const
+        {
+            std::size_t usage = Dense.capacity() * sizeof(Type) + ReverseMapping.capacity() * sizeof(SizeType) + Pages.capacity() * sizeof(PagePointer);
+
+            for (const PagePointer& page : Pages)
+            {
+                usage += page ? sizeof(Page) : 0;
+            }
+
+            return usage;
+        }
+
+    private:
+        using Page = std::array<SizeType, PageSize>;
+        using PagePointer = std::unique_ptr<Page>;
+
+        static constexpr SizeType MinimumCapacity = 64;
+        static constexpr SizeType ShrinkFactor = 4;
+
+        [[nodiscard]] inline SizeType& Slot(SizeType index)
+        {
+            SizeType page = index / PageSize;
+
+            if (page >= Pages.size())
+            {
+                Pages.resize(page + 1);
+            }
+
+            if (!Pages[page])
+            {
+                Pages[page] = std::make_unique<Page>();
+                Pages[page]->fill(DeadIndex);
+            }
+
+            return (*Pages[page])[index % PageSize];
+        }
+
+        std::vector<Type> Dense;
+        std::vector<SizeType> ReverseMapping;
+        std::vector<PagePointer> Pages;
+    };
+}
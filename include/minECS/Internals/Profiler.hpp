@@ -0,0 +1,235 @@
+#pragma once
+
+#define MINECS_PROFILE_CONCATENATE_IMPLEMENTATION(left, right) left##right
+#define MINECS_PROFILE_CONCATENATE(left, right) MINECS_PROFILE_CONCATENATE_IMPLEMENTATION(left, right)
+
+#if defined(MINECS_ENABLE_PROFILING)
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace minECS
+{
+    struct ProfileEvent
+    {
+        const char* Name;
+        std::uint64_t Start;
+        std::uint64_t Duration;
+    };
+
+    class Profiler
+    {
+    public:
+        static constexpr std::size_t ChunkSize = 4096;
+
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        [[nodiscard]] static inline Profiler& Get()
+        {
+            static Profiler profiler;
+
+            return profiler;
+        }
+
+        [[nodiscard]] inline std::uint64_t Now() const
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Epoch).count());
+        }
+
+        inline void Record(const char* name, std::uint64_t start, std::uint64_t end)
+        {
+            ThreadBuffer& buffer = GetThreadBuffer();
+            Chunk* chunk = buffer.Tail;
+            std::size_t count = chunk->Count.load(std::memory_order_relaxed);
+
+            if (count == ChunkSize)
+            {
+                Chunk* next = new Chunk();
+
+                chunk->Next.store(next, std::memory_order_release);
+                buffer.Tail = next;
+
+                chunk = next;
+                count = 0;
+            }
+
+            chunk->Events[count] = ProfileEvent{name, start, end - start};
+            chunk->Count.store(count + 1, std::memory_order_release);
+        }
+
+        template <typename TFunction>
+        inline void ForEachEvent(TFunction&& function) const
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+
+            for (const auto& buffer : Buffers)
+            {
+                for (const Chunk* chunk = &buffer->Head; chunk; chunk = chunk->Next.load(std::memory_order_acquire))
+                {
+                    std::size_t count = chunk->Count.load(std::memory_order_acquire);
+
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        function(buffer->ThreadID, chunk->Events[i]);
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] inline bool WriteChromeTrace(const std::string& path) const
+        {
+            std::FILE* file = std::fopen(path.c_str(), "w");
+
+            if (!file)
+            {
+                std::cerr << "Failed to open trace " << path << "\n";
+
+                return false;
+            }
+
+            bool first = true;
+
+            std::fputs("{\"traceEvents\":[", file);
+
+            ForEachEvent([&](std::uint32_t thread, const ProfileEvent& event)
+            {
+                std::fputs(first ? "\n" : ",\n", file);
+                std::fputs("{\"name\":\"", file);
+
+                for (const char* c = event.Name; *c; c++)
+                {
+                    if (*c == '"' || *c == '\\')
+                    {
+                        std::fputc('\\', file);
+                    }
+
+                    std::fputc(*c, file);
+                }
+
+                std::fprintf(file, "\",\"cat\":\"minECS\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u}",
+                             static_cast<double>(event.Start) / 1000.0, static_cast<double>(event.Duration) / 1000.0, thread);
+
+                first = false;
+            });
+
+            std::fputs("\n],\"displayTimeUnit\":\"ns\"}\n", file);
+            std::fclose(file);
+
+            return true;
+        }
+
+        inline void Clear()
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+
+            for (auto& buffer : Buffers)
+            {
+                Release(buffer->Head.Next.exchange(nullptr, std::memory_order_acq_rel));
+
+                buffer->Head.Count.store(0, std::memory_order_release);
+                buffer->Tail = &buffer->Head;
+            }
+        }
+
+    private:
+        struct Chunk
+        {
+            std::array<ProfileEvent, ChunkSize> Events;
+            std::atomic<std::size_t> Count = 0;
+            std::atomic<Chunk*> Next = nullptr;
+        };
+
+        struct ThreadBuffer
+        {
+            Chunk Head;
+            Chunk* Tail = &Head;
+
+            std::uint32_t ThreadID = 0;
+
+            ~ThreadBuffer()
+            {
+                Release(Head.Next.load(std::memory_order_acquire));
+            }
+        };
+
+        Profiler()
+            : Epoch(std::chrono::steady_clock::now())
+        {
+        }
+
+        static inline void Release(Chunk* chunk)
+        {
+            while (chunk)
+            {
+                Chunk* next = chunk->Next.load(std::memory_order_acquire);
+
+                delete chunk;
+
+                chunk = next;
+            }
+        }
+
+        [[nodiscard]] inline ThreadBuffer& GetThreadBuffer()
+        {
+            thread_local ThreadBuffer* buffer = nullptr;
+
+            if (!buffer)
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+
+                Buffers.push_back(std::make_unique<ThreadBuffer>());
+
+                buffer = Buffers.back().get();
+                buffer->ThreadID = static_cast<std::uint32_t>(Buffers.size() - 1);
+            }
+
+            return *buffer;
+        }
+
+        std::chrono::steady_clock::time_point Epoch;
+
+        std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+
+        mutable std::mutex Mutex;
+    };
+
+    class ProfileScope
+    {
+    public:
+        inline ProfileScope(const char* name)
+            : Name(name), Start(Profiler::Get().Now())
+        {
+        }
+
+        inline ~ProfileScope()
+        {
+            Profiler& profiler = Profiler::Get();
+
+            profiler.Record(Name, Start, profiler.Now());
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* Name;
+        std::uint64_t Start;
+    };
+}
+
+#define MINECS_PROFILE_SCOPE(name) ::minECS::ProfileScope MINECS_PROFILE_CONCATENATE(minECSProfileScope, __LINE__)(name)
+
+#else
+
+#define MINECS_PROFILE_SCOPE(name) static_cast<void>(0)
+
+#endif
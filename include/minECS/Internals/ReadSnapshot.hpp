@@ -0,0 +1,265 @@
+#pragma once
+
+#include <minECS/Internals/Entity.hpp>
+#include <minECS/Internals/EpochManager.hpp>
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename TECS>
+    requires IsECS<TECS>
+    class ReadSnapshot
+    {
+    public:
+        using SizeType = typename TECS::SizeType;
+        using EntityType = Entity<SizeType>;
+        using BitsetType = typename TECS::BitsetType;
+        using DescriptorType = typename TECS::DescriptorType;
+
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
+
+        inline ReadSnapshot(const TECS& ecs, std::uint64_t version)
+            : Version(version)
+        {
+            SizeType slots = ecs.GetEntitySlotCount();
+
+            Entities.reserve(slots);
+            Disabled.resize(slots, false);
+
+            for (SizeType id = 0; id < slots; id++)
+            {
+                ValueResult<EntityType> entity = ecs.GetEntity(id);
+
+                Entities.push_back(entity.Succeeded() ? entity.GetValue() : EntityType(DeadIndex, 0));
+                Disabled[id] = entity.Succeeded() && !ecs.IsEntityEnabled(entity.GetValue());
+            }
+
+            const auto& archetypes = ecs.GetArchetypes();
+
+            for (SizeType index = 0; index < archetypes.Size(); index++)
+            {
+                const auto& [mask, archetype] = archetypes.At(index);
+
+                if (archetypes.IsAlive(index) && !archetype.Empty())
+                {
+                    Archetypes.push_back({mask, std::vector<EntityType>(archetype.begin(), archetype.end())});
+                }
+            }
+
+            CopyComponents(ecs, slots, std::make_index_sequence<DescriptorType::ComponentCount>{});
+        }
+
+        [[nodiscard]] inline std::uint64_t GetVersion() const
+        {
+            return Version;
+        }
+
+        [[nodiscard]] inline SizeType GetEntitySlotCount() const
+        {
+            return Entities.size();
+        }
+
+        [[nodiscard]] inline bool HasEntity(EntityType entity) const
+        {
+            SizeType id = entity.GetID();
+
+            return id < Entities.size() && Entities[id].GetID() != DeadIndex && Entities[id].GetGeneration() == entity.GetGeneration();
+        }
+
+        [[nodiscard]] inline bool IsEntityEnabled(EntityType entity) const
+        {
+            return HasEntity(entity) && !Disabled[entity.GetID()];
+        }
+
+        template <typename TComponent>
+        requires(DescriptorType::template Contains<TComponent>)
+        [[nodiscard]] inline ReferenceResult<const TComponent> Get(EntityType entity) const
+        {
+            const ComponentCopy<TComponent>& copy = std::get<DescriptorType::template Index<TComponent>()>(Components);
+
+            if (!HasEntity(entity) || copy.Sparse[entity.GetID()] == DeadIndex)
+            {
+                return ReferenceResult<const TComponent>(nullptr, false);
+            }
+
+            return ReferenceResult<const TComponent>(&copy.Dense[copy.Sparse[entity.GetID()]], true);
+        }
+
+        template <typename... TQueried, typename TFunction>
+        requires((DescriptorType::template Contains<TQueried> && ...) && sizeof...(TQueried) != 0)
+        inline void ForEach(TFunction&& function, bool includeDisabled = false) const
+        {
+            BitsetType mask;
+
+            (mask.set(DescriptorType::template Index<TQueried>()), ...);
+
+            for (const ArchetypeCopy& archetype : Archetypes)
+            {
+                if ((archetype.Mask & mask) != mask)
+                {
+                    continue;
+                }
+
+                for (const EntityType& entity : archetype.Entities)
+                {
+                    if (!includeDisabled && Disabled[entity.GetID()])
+                    {
+                        continue;
+                    }
+
+                    function(entity, GetUnchecked<TQueried>(entity.GetID())...);
+                }
+            }
+        }
+
+    private:
+        template <typename T>
+        struct ComponentCopy
+        {
+            std::vector<T> Dense;
+            std::vector<SizeType> Sparse;
+        };
+
+        struct ArchetypeCopy
+        {
+            BitsetType Mask;
+            std::vector<EntityType> Entities;
+        };
+
+        template <typename TDeclaration>
+        using ComponentCopyFor = ComponentCopy<ComponentTypeOf<TDeclaration>>;
+
+        template <std::size_t... Ns>
+        inline void CopyComponents(const TECS& ecs, SizeType slots, std::index_sequence<Ns...>)
+        {
+            (CopyComponentsAt<Ns>(ecs, slots), ...);
+        }
+
+        template <std::size_t N>
+        inline void CopyComponentsAt(const TECS& ecs, SizeType slots)
+        {
+            using ComponentType = ComponentTypeOf<std::tuple_element_t<N, typename DescriptorType::ComponentDeclarations>>;
+
+            const auto& storage = ecs.template GetSparseSet<ComponentType>();
+            ComponentCopy<ComponentType>& copy = std::get<N>(Components);
+
+            copy.Dense.reserve(storage.Size());
+            copy.Sparse.assign(slots, DeadIndex);
+
+            storage.ForEach([&copy](SizeType id, const ComponentType& component)
+            {
+                copy.Sparse[id] = static_cast<SizeType>(copy.Dense.size());
+                copy.Dense.push_back(component);
+            });
+        }
+
+        template <typename TComponent>
+        [[nodiscard]] inline const TComponent& GetUnchecked(SizeType id) const
+        {
+            const ComponentCopy<TComponent>& copy = std::get<DescriptorType::template Index<TComponent>()>(Components);
+
+            return copy.Dense[copy.Sparse[id]];
+        }
+
+        std::uint64_t Version;
+
+        std::vector<EntityType> Entities;
+        std::vector<bool> Disabled;
+        std::vector<ArchetypeCopy> Archetypes;
+
+        typename TransformTuple<typename DescriptorType::ComponentDeclarations, ComponentCopyFor>::Type Components;
+    };
+
+    template <typename TECS>
+    requires IsECS<TECS>
+    class SnapshotPublisher
+    {
+    public:
+        using SnapshotType = ReadSnapshot<TECS>;
+
+        class Handle
+        {
+        public:
+            [[nodiscard]] inline bool IsValid() const
+            {
+                return Snapshot != nullptr;
+            }
+
+            [[nodiscard]] inline const SnapshotType& operator*() const
+            {
+                return *Snapshot;
+            }
+
+            [[nodiscard]] inline const SnapshotType* operator->() const
+            {
+                return Snapshot;
+            }
+
+        private:
+            friend class SnapshotPublisher;
+
+            inline Handle(EpochManager::Guard&& guard, const SnapshotType* snapshot)
+                : Guard(std::move(guard)), Snapshot(snapshot)
+            {
+            }
+
+            EpochManager::Guard Guard;
+
+            const SnapshotType* Snapshot;
+        };
+
+        SnapshotPublisher() = default;
+
+        inline ~SnapshotPublisher()
+        {
+            delete Current.load(std::memory_order_acquire);
+        }
+
+        SnapshotPublisher(const SnapshotPublisher&) = delete;
+        SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+        inline void Publish(const TECS& ecs)
+        {
+            const SnapshotType* previous = Current.exchange(new SnapshotType(ecs, ++Version), std::memory_order_seq_cst);
+
+            if (previous)
+            {
+                Epochs.Retire(previous);
+            }
+
+            static_cast<void>(Epochs.Reclaim());
+        }
+
+        [[nodiscard]] inline Handle Acquire()
+        {
+            EpochManager::Guard guard = Epochs.Enter();
+
+            return Handle(std::move(guard), Current.load(std::memory_order_seq_cst));
+        }
+
+        inline std::size_t Reclaim()
+        {
+            return Epochs.Reclaim();
+        }
+
+        [[nodiscard]] inline std::size_t GetPendingCount() const
+        {
+            return Epochs.GetPendingCount();
+        }
+
+    private:
+        EpochManager Epochs;
+
+        std::atomic<const SnapshotType*> Current = nullptr;
+
+        std::uint64_t Version = 0;
+    };
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class ResourceRegistry
+    {
+    public:
+        using SizeType = TSizeType;
+
+        ResourceRegistry() = default;
+        ~ResourceRegistry() = default;
+
+        ResourceRegistry(const ResourceRegistry&) = delete;
+        ResourceRegistry(ResourceRegistry&&) noexcept = default;
+
+        ResourceRegistry& operator=(const ResourceRegistry&) = delete;
+        ResourceRegistry& operator=(ResourceRegistry&&) noexcept = default;
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] static inline SizeType TypeIndex()
+        {
+            static const SizeType index = NextTypeIndex().fetch_add(1, std::memory_order_relaxed);
+
+            return index;
+        }
+
+        template <typename TResource, typename... TArgs>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline ReferenceResult<TResource> Emplace(TArgs&&... args)
+        {
+            SizeType index = TypeIndex<TResource>();
+
+            if (index >= Slots.size())
+            {
+                Slots.resize(index + 1);
+            }
+
+            Slot& slot = Slots[index];
+
+            if (slot)
+            {
+                return ReferenceResult<TResource>(static_cast<TResource*>(slot.get()), false);
+            }
+
+            slot = Slot(new TResource(std::forward<TArgs>(args)...), Deleter{&Destroy<TResource>});
+
+            return ReferenceResult<TResource>(static_cast<TResource*>(slot.get()), true);
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline ReferenceResult<TResource> Get()
+        {
+            SizeType index = TypeIndex<TResource>();
+
+            if (index >= Slots.size() || !Slots[index])
+            {
+                return ReferenceResult<TResource>(nullptr, false);
+            }
+
+            return ReferenceResult<TResource>(static_cast<TResource*>(Slots[index].get()), true);
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline ReferenceResult<const TResource> Get() const
+        {
+            SizeType index = TypeIndex<TResource>();
+
+            if (index >= Slots.size() || !Slots[index])
+            {
+                return ReferenceResult<const TResource>(nullptr, false);
+            }
+
+            return ReferenceResult<const TResource>(static_cast<const TResource*>(Slots[index].get()), true);
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline bool Contains() const
+        {
+            SizeType index = TypeIndex<TResource>();
+
+            return index < Slots.size() && Slots[index];
+        }
+
+        template <typename TResource>
+        requires CanBeComponent<TResource>
+        [[nodiscard]] inline bool Remove()
+        {
+            SizeType index = TypeIndex<TResource>();
+
+            if (index >= Slots.size() || !Slots[index])
+            {
+                return false;
+            }
+
+            Slots[index].reset();
+
+            return true;
+        }
+
+        inline void Clear()
+        {
+            Slots.clear();
+        }
+
+    private:
+        struct Deleter
+        {
+            void (*Function)(void*) = nullptr;
+
+            void operator()(void* resource) const
+            {
+                Function(resource);
+            }
+        };
+
+        using Slot = std::unique_ptr<void, Deleter>;
+
+        template <typename TResource>
+        static inline void Destroy(void* resource)
+        {
+            delete static_cast<TResource*>(resource);
+        }
+
+        [[nodiscard]] static inline std::atomic<SizeType>& NextTypeIndex()
+        {
+            static std::atomic<SizeType> next = 0;
+
+            return next;
+        }
+
+        std::vector<Slot> Slots;
+    };
+}
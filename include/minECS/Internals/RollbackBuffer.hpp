@@ -0,0 +1,236 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    class RollbackBuffer
+    {
+    public:
+        static constexpr std::size_t BlockSize = 16384;
+
+        inline RollbackBuffer(std::size_t capacity = 8)
+            : Frames(capacity == 0 ? 1 : capacity)
+        {
+        }
+
+        inline void BeginCapture(std::uint64_t tick)
+        {
+            Pending.clear();
+            PendingTick = tick;
+            Ordinal = 0;
+        }
+
+        template <typename T>
+        requires std::is_trivially_copyable_v<T>
+        inline void Capture(const T* data, std::size_t count)
+        {
+            const std::byte* bytes = reinterpret_cast<const std::byte*>(data);
+            const Stream* previous = nullptr;
+
+            if (Count != 0 && Ordinal < Frames[Newest].Streams.size())
+            {
+                previous = &Frames[Newest].Streams[Ordinal];
+            }
+
+            Stream& stream = Pending.emplace_back();
+
+            stream.Size = count * sizeof(T);
+            stream.Blocks.reserve((stream.Size + BlockSize - 1) / BlockSize);
+
+            for (std::size_t offset = 0, block = 0; offset < stream.Size; offset += BlockSize, block++)
+            {
+                std::size_t length = stream.Size - offset < BlockSize ? stream.Size - offset : BlockSize;
+
+                if (previous && block < previous->Blocks.size())
+                {
+                    const BlockPointer& candidate = previous->Blocks[block];
+
+                    if (candidate->size() == length && std::memcmp(candidate->data(), bytes + offset, length) == 0)
+                    {
+                        stream.Blocks.push_back(candidate);
+
+                        continue;
+                    }
+                }
+
+                stream.Blocks.push_back(std::make_shared<const Block>(bytes + offset, bytes + offset + length));
+                CopiedBlocks++;
+            }
+
+            Ordinal++;
+        }
+
+        template <typename TContainer>
+        requires requires(const TContainer& container) { container.data(); container.size(); }
+        inline void Capture(const TContainer& container)
+        {
+            Capture(container.data(), container.size());
+        }
+
+        template <typename T>
+        inline void CaptureValue(const T& value)
+        {
+            Capture(&value, 1);
+        }
+
+        inline void EndCapture()
+        {
+            std::size_t slot = Count == 0 ? 0 : (Newest + 1) % Frames.size();
+            Frame& frame = Frames[slot];
+
+            frame.Streams = std::move(Pending);
+            frame.Tick = PendingTick;
+
+            Pending = std::vector<Stream>();
+            Newest = slot;
+            Count = Count < Frames.size() ? Count + 1 : Count;
+        }
+
+        [[nodiscard]] inline bool BeginRestore(std::uint64_t tick)
+        {
+            for (std::size_t age = 0; age < Count; age++)
+            {
+                std::size_t slot = (Newest + Frames.size() - age) % Frames.size();
+
+                if (Frames[slot].Tick != tick)
+                {
+                    continue;
+                }
+
+                for (std::size_t newer = 0; newer < age; newer++)
+                {
+                    Frames[(Newest + Frames.size() - newer) % Frames.size()].Streams.clear();
+                }
+
+                Newest = slot;
+                Count -= age;
+                Reading = slot;
+                Ordinal = 0;
+
+                return true;
+            }
+
+            std::cerr << "Failed to find rollback frame for tick " << tick << "\n";
+
+            return false;
+        }
+
+        template <typename T>
+        requires std::is_trivially_copyable_v<T>
+        [[nodiscard]] inline std::size_t GetRestoreCount() const
+        {
+            return Frames[Reading].Streams[Ordinal].Size / sizeof(T);
+        }
+
+        template <typename T>
+        requires std::is_trivially_copyable_v<T>
+        inline void Restore(T* data)
+        {
+            std::byte* bytes = reinterpret_cast<std::byte*>(data);
+            std::size_t offset = 0;
+
+            for (const BlockPointer& block : Frames[Reading].Streams[Ordinal].Blocks)
+            {
+                std::memcpy(bytes + offset, block->data(), block->size());
+
+                offset += block->size();
+            }
+
+            Ordinal++;
+        }
+
+        template <typename TContainer>
+        requires requires(TContainer& container) { container.data(); container.resize(0); }
+        inline void Restore(TContainer& container)
+        {
+            container.resize(GetRestoreCount<std::remove_pointer_t<decltype(container.data())>>());
+
+            Restore(container.data());
+        }
+
+        template <typename T>
+        [[nodiscard]] inline T RestoreValue()
+        {
+            T value;
+
+            Restore(&value);
+
+            return value;
+        }
+
+        [[nodiscard]] inline bool HasTick(std::uint64_t tick) const
+        {
+            for (std::size_t age = 0; age < Count; age++)
+            {
+                if (Frames[(Newest + Frames.size() - age) % Frames.size()].Tick == tick)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        [[nodiscard]] inline std::size_t Size() const
+        {
+            return Count;
+        }
+
+        [[nodiscard]] inline std::size_t Capacity() const
+        {
+            return Frames.size();
+        }
+
+        [[nodiscard]] inline std::size_t GetCopiedBlockCount() const
+        {
+            return CopiedBlocks;
+        }
+
+        inline void Clear()
+        {
+            for (Frame& frame : Frames)
+            {
+                frame.Streams.clear();
+            }
+
+            Pending.clear();
+            Count = 0;
+            Newest = 0;
+        }
+
+    private:
+        using Block = std::vector<std::byte>;
+        using BlockPointer = std::shared_ptr<const Block>;
+
+        struct Stream
+        {
+            std::vector<BlockPointer> Blocks;
+            std::size_t Size = 0;
+        };
+
+        struct Frame
+        {
+            std::vector<Stream> Streams;
+            std::uint64_t Tick = 0;
+        };
+
+        std::vector<Frame> Frames;
+        std::vector<Stream> Pending;
+
+        std::uint64_t PendingTick = 0;
+
+        std::size_t Count = 0;
+        std::size_t Newest = 0;
+        std::size_t Reading = 0;
+        std::size_t Ordinal = 0;
+        std::size_t CopiedBlocks = 0;
+    };
+}
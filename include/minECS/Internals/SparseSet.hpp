@@ -3,21 +3,25 @@
 #include <minECS/Internals/Result.hpp>
 #include <minECS/Internals/Traits.hpp>
 
+#include <iterator>
 #include <limits>
+#include <utility>
 #include <vector>
 
 namespace minECS
 {
-    template <typename T, typename TSizeType>
+    template <typename T, typename TSizeType, typename TDense, typename TIndex>
     requires IsSizeType<TSizeType>
     class SparseSet
     {
     public:
         using Type = T;
         using SizeType = TSizeType;
+        using DenseType = TDense;
+        using IndexType = TIndex;
 
-        using Iterator = typename std::vector<Type>::iterator;
-        using ConstIterator = typename std::vector<Type>::const_iterator;
+        using Iterator = typename DenseType::iterator;
+        using ConstIterator = typename DenseType::const_iterator;
 
         inline SparseSet() = default;
         inline ~SparseSet() = default;
@@ -31,6 +35,17 @@ namespace minECS
         static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
 
         [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, const Type& element)
+        {
+            return Emplace(index, element);
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, Type&& element)
+        {
+            return Emplace(index, std::move(element));
+        }
+
+        template <typename... TArgs>
+        [[nodiscard]] inline ReferenceResult<Type> Emplace(SizeType index, TArgs&&... args)
         {
             if (index >= Sparse.size())
             {
@@ -44,12 +59,58 @@ namespace minECS
 
             Sparse[index] = Dense.size();
 
-            Dense.push_back(element);
+            Dense.emplace_back(std::forward<TArgs>(args)...);
             ReverseMapping.push_back(index);
 
             return ReferenceResult<Type>(&Dense[Sparse[index]], true);
         }
 
+        inline void Fill(const std::vector<SizeType>& indices, const Type& element)
+        {
+            SizeType offset = Dense.size();
+            SizeType count = indices.size();
+
+            Dense.insert(Dense.end(), count, element);
+            ReverseMapping.insert(ReverseMapping.end(), indices.begin(), indices.end());
+
+            for (SizeType i = 0; i < count; i++)
+            {
+                SizeType index = indices[i];
+
+                if (index >= Sparse.size())
+                {
+                    Sparse.resize(index + 1, DeadIndex);
+                }
+
+                Sparse[index] = offset + i;
+            }
+        }
+
+        template <typename TRemap>
+        inline void Merge(SparseSet& other, TRemap&& remap)
+        {
+            SizeType offset = Dense.size();
+            SizeType count = other.Dense.size();
+
+            Dense.insert(Dense.end(), std::make_move_iterator(other.Dense.begin()), std::make_move_iterator(other.Dense.end()));
+            ReverseMapping.reserve(ReverseMapping.size() + count);
+
+            for (SizeType i = 0; i < count; i++)
+            {
+                SizeType index = remap(other.ReverseMapping[i]);
+
+                if (index >= Sparse.size())
+                {
+                    Sparse.resize(index + 1, DeadIndex);
+                }
+
+                Sparse[index] = offset + i;
+                ReverseMapping.push_back(index);
+            }
+
+            other.Clear();
+        }
+
         [[nodiscard]] inline bool Remove(SizeType index)
         {
             if (index >= Sparse.size() || Sparse[index] == DeadIndex)
@@ -94,14 +155,42 @@ namespace minECS
             return ReferenceResult<Type>(&Dense[Sparse[index]], true);
         }
 
-        [[nodiscard]] inline const ReferenceResult<Type> Get(SizeType index) const
+        [[nodiscard]] inline ReferenceResult<const Type> Get(SizeType index) const
         {
             if (index >= Sparse.size() || Sparse[index] == DeadIndex)
             {
-                return ReferenceResult<Type>(nullptr, false);
+                return ReferenceResult<const Type>(nullptr, false);
             }
 
-            return ReferenceResult<Type>(&Dense[Sparse[index]], true);
+            return ReferenceResult<const Type>(&Dense[Sparse[index]], true);
+        }
+
+        [[nodiscard]] inline Type& GetUnchecked(SizeType index)
+        {
+            return Dense[Sparse[index]];
+        }
+
+        [[nodiscard]] inline const Type& GetUnchecked(SizeType index) const
+        {
+            return Dense[Sparse[index]];
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function)
+        {
+            for (SizeType i = 0; i < Dense.size(); i++)
+            {
+                function(ReverseMapping[i], Dense[i]);
+            }
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function) const
+        {
+            for (SizeType i = 0; i < Dense.size(); i++)
+            {
+                function(ReverseMapping[i], Dense[i]);
+            }
         }
 
         [[nodiscard]] inline bool Contains(SizeType index) const
@@ -139,26 +228,36 @@ namespace minECS
             return Dense.cend();
         }
 
-        [[nodiscard]] inline std::vector<Type>& GetDense()
+        [[nodiscard]] inline DenseType& GetDense()
         {
             return Dense;
         }
 
-        [[nodiscard]] inline const std::vector<Type>& GetDense() const
+        [[nodiscard]] inline const DenseType& GetDense() const
         {
             return Dense;
         }
 
-        [[nodiscard]] inline std::vector<TSizeType>& GetSparse()
+        [[nodiscard]] inline IndexType& GetSparse()
         {
             return Sparse;
         }
 
-        [[nodiscard]] inline const std::vector<TSizeType>& GetSparse() const
+        [[nodiscard]] inline const IndexType& GetSparse() const
         {
             return Sparse;
         }
 
+        [[nodiscard]] inline IndexType& GetReverseMapping()
+        {
+            return ReverseMapping;
+        }
+
+        [[nodiscard]] inline const IndexType& GetReverseMapping() const
+        {
+            return ReverseMapping;
+        }
+
         [[nodiscard]] inline SizeType Size() const
         {
             return Dense.size();
@@ -176,6 +275,40 @@ namespace minECS
             ReverseMapping.clear();
         }
 
+        inline void Arrange(const std::vector<SizeType>& order)
+        {
+            SizeType next = 0;
+
+            for (const SizeType& index : order)
+            {
+                if (!Contains(index))
+                {
+                    continue;
+                }
+
+                SizeType current = Sparse[index];
+
+                if (current != next)
+                {
+                    SizeType displaced = ReverseMapping[next];
+
+                    std::swap(Dense[current], Dense[next]);
+                    std::swap(ReverseMapping[current], ReverseMapping[next]);
+
+                    Sparse[displaced] = current;
+                    Sparse[index] = next;
+                }
+
+                next++;
+            }
+        }
+
+        inline void Reserve(SizeType count)
+        {
+            Dense.reserve(count);
+            ReverseMapping.reserve(count);
+        }
+
         inline void ShrinkToFit()
         {
             Dense.shrink_to_fit();
@@ -183,9 +316,72 @@ namespace minECS
             ReverseMapping.shrink_to_fit();
         }
 
+        inline void Trim()
+        {
+            if (Dense.capacity() > MinimumCapacity && Dense.size() * ShrinkFactor < Dense.capacity())
+            {
+                if constexpr (requires { typename DenseType::allocator_type; })
+                {
+                    Shrink(Dense, Dense.size() * 2);
+                }
+                else
+                {
+                    Dense.shrink_to_fit();
+                }
+
+                Shrink(ReverseMapping, ReverseMapping.size() * 2);
+            }
+
+            if (Sparse.size() > MinimumCapacity && Dense.size() * ShrinkFactor < Sparse.size())
+            {
+                SizeType highest = 0;
+
+                for (const SizeType& index : ReverseMapping)
+                {
+                    highest = index + 1 > highest ? index + 1 : highest;
+                }
+
+                if (highest * ShrinkFactor < Sparse.size())
+                {
+                    Sparse.resize(highest);
+
+                    Shrink(Sparse, highest * 2);
+                }
+            }
+        }
+
+        [[nodiscard]] inline std::size_t MemoryUsage() const
+        {
+            return Dense.capacity() * sizeof(Type) + (Sparse.capacity() + ReverseMapping.capacity()) * sizeof(SizeType);
+        }
+
     private:
-        std::vector<Type> Dense;
-        std::vector<SizeType> Sparse;
-        std::vector<SizeType> ReverseMapping;
+        static constexpr SizeType MinimumCapacity = 64;
+        static constexpr SizeType ShrinkFactor = 4;
+
+        template <typename TVector>
+        static inline void Shrink(TVector& vector, SizeType capacity)
+        {
+            if (capacity < MinimumCapacity)
+            {
+                capacity = MinimumCapacity;
+            }
+
+            if (capacity >= vector.capacity())
+            {
+                return;
+            }
+
+            TVector shrunk;
+
+            shrunk.reserve(capacity);
+            shrunk.insert(shrunk.end(), std::make_move_iterator(vector.begin()), std::make_move_iterator(vector.end()));
+
+            vector.swap(shrunk);
+        }
+
+        DenseType Dense;
+        IndexType Sparse;
+        IndexType ReverseMapping;
     };
 }
\ No newline at end of file
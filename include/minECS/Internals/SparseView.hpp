@@ -0,0 +1,179 @@
+#pragma once
+
+#include <minECS/Internals/Entity.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <array>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename TECS, typename... TComponents>
+    requires IsECS<TECS> && ComponentsAreUnique<TComponents...> && (TECS::DescriptorType::template Contains<TComponents> && ...) && (sizeof...(TComponents) != 0)
+    class SparseView
+    {
+    public:
+        using SizeType = typename TECS::SizeType;
+        using EntityType = Entity<SizeType>;
+        using StoragesType = std::tuple<typename TECS::template StorageType<TComponents>*...>;
+
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
+        static constexpr SizeType PrefetchDistance = 8;
+
+        SparseView(TECS* ecs, bool includeDisabled = false)
+            : ECS(ecs), Storages(&ecs->template GetSparseSet<TComponents>()...), IncludeDisabled(includeDisabled)
+        {
+            (MarkStorageWritten(ecs->template GetSparseSet<TComponents>()), ...);
+
+            std::array<SizeType, sizeof...(TComponents)> sizes = {ecs->template GetSparseSet<TComponents>().Size()...};
+
+            for (SizeType i = 1; i < sizes.size(); i++)
+            {
+                if (sizes[i] < sizes[Driver])
+                {
+                    Driver = i;
+                }
+            }
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function)
+        {
+            ForEachImplementation(function, std::index_sequence_for<TComponents...>{});
+        }
+
+        [[nodiscard]] inline SizeType GetDriverIndex() const
+        {
+            return Driver;
+        }
+
+        [[nodiscard]] inline SizeType SizeHint() const
+        {
+            return SizeHintImplementation(std::index_sequence_for<TComponents...>{});
+        }
+
+    private:
+        template <typename TFunction, std::size_t... Ns>
+        inline void ForEachImplementation(TFunction& function, std::index_sequence<Ns...>)
+        {
+            ((Driver == Ns ? Drive<Ns>(function) : void()), ...);
+        }
+
+        template <std::size_t N, typename TFunction>
+        inline void Drive(TFunction& function)
+        {
+            if constexpr (IsDirectSet<std::remove_pointer_t<std::tuple_element_t<N, StoragesType>>>)
+            {
+                std::get<N>(Storages)->ForEachIndex([this, &function](SizeType id)
+                {
+                    if (ContainsAll<N>(id, std::index_sequence_for<TComponents...>{}))
+                    {
+                        Invoke(function, id, std::index_sequence_for<TComponents...>{});
+                    }
+                });
+            }
+            else
+            {
+                DriveDense<N>(function);
+            }
+        }
+
+        template <std::size_t N, typename TFunction>
+        inline void DriveDense(TFunction& function)
+        {
+            const auto& ids = std::get<N>(Storages)->GetReverseMapping();
+
+            for (SizeType i = 0; i < ids.size(); i++)
+            {
+                if (i + PrefetchDistance < ids.size())
+                {
+                    PrefetchProbes<N>(ids[i + PrefetchDistance], std::index_sequence_for<TComponents...>{});
+                }
+
+                const SizeType id = ids[i];
+
+                if (id == DeadIndex || !ContainsAll<N>(id, std::index_sequence_for<TComponents...>{}))
+                {
+                    continue;
+                }
+
+                Invoke(function, id, std::index_sequence_for<TComponents...>{});
+            }
+        }
+
+        template <typename TFunction, std::size_t... Ns>
+        inline void Invoke(TFunction& function, SizeType id, std::index_sequence<Ns...>)
+        {
+            EntityType entity = ECS->GetEntity(id).GetValue();
+
+            if (!IncludeDisabled && !ECS->IsEntityEnabled(entity))
+            {
+                return;
+            }
+
+            function(entity, std::get<Ns>(Storages)->GetUnchecked(id)...);
+        }
+
+        template <std::size_t N, std::size_t... Ns>
+        [[nodiscard]] inline bool ContainsAll(SizeType id, std::index_sequence<Ns...>) const
+        {
+            return ((Ns == N || std::get<Ns>(Storages)->Contains(id)) && ...);
+        }
+
+        template <std::size_t N, std::size_t... Ns>
+        inline void PrefetchProbes(SizeType id, std::index_sequence<Ns...>) const
+        {
+            ((Ns != N ? Prefetch(*std::get<Ns>(Storages), id) : void()), ...);
+        }
+
+        template <typename TStorage>
+        static inline void Prefetch(const TStorage& storage, SizeType id)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (IsDirectSet<TStorage>)
+            {
+                if (id < storage.GetData().size())
+                {
+                    __builtin_prefetch(storage.GetData().data() + id);
+                }
+            }
+            else if constexpr (requires { storage.GetSparse(); })
+            {
+                if (id < storage.GetSparse().size())
+                {
+                    __builtin_prefetch(storage.GetSparse().data() + id);
+                }
+            }
+            else
+            {
+                static_cast<void>(storage);
+                static_cast<void>(id);
+            }
+#else
+            static_cast<void>(storage);
+            static_cast<void>(id);
+#endif
+        }
+
+        template <std::size_t... Ns>
+        [[nodiscard]] inline SizeType SizeHintImplementation(std::index_sequence<Ns...>) const
+        {
+            SizeType size = 0;
+
+            ((Driver == Ns ? static_cast<void>(size = std::get<Ns>(Storages)->Size()) : void()), ...);
+
+            return size;
+        }
+
+        TECS* ECS;
+
+        StoragesType Storages;
+
+        SizeType Driver = 0;
+
+        bool IncludeDisabled;
+    };
+}
@@ -0,0 +1,504 @@
+#pragma once
+
+#include <minECS/Internals/Result.hpp>
+#include <minECS/Internals/Traits.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace minECS
+{
+    template <typename T, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class StableSet
+    {
+    public:
+        using Type = T;
+        using SizeType = TSizeType;
+
+        static constexpr SizeType DeadIndex = std::numeric_limits<SizeType>::max();
+        static constexpr SizeType PageSize = 1024;
+
+        template <bool IsConst>
+        class BasicIterator
+        {
+        public:
+            using SetType = std::conditional_t<IsConst, const StableSet, StableSet>;
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const Type*, Type*>;
+            using reference = std::conditional_t<IsConst, const Type&, Type&>;
+
+            BasicIterator() = default;
+
+            BasicIterator(SetType* set, SizeType slot)
+                : Set(set), Current(set->NextOccupied(slot))
+            {
+            }
+
+            reference operator*() const
+            {
+                return Set->Slot(Current);
+            }
+
+            pointer operator->() const
+            {
+                return &Set->Slot(Current);
+            }
+
+            BasicIterator& operator++()
+            {
+                Current = Set->NextOccupied(Current + 1);
+
+                return *this;
+            }
+
+            BasicIterator operator++(int)
+            {
+                BasicIterator previous = *this;
+
+                ++*this;
+
+                return previous;
+            }
+
+            bool operator==(const BasicIterator& other) const
+            {
+                return Current == other.Current;
+            }
+
+            bool operator!=(const BasicIterator& other) const
+            {
+                return !(*this == other);
+            }
+
+            [[nodiscard]] SizeType GetSlot() const
+            {
+                return Current;
+            }
+
+        private:
+            SetType* Set = nullptr;
+
+            SizeType Current = 0;
+        };
+
+        using Iterator = BasicIterator<false>;
+        using ConstIterator = BasicIterator<true>;
+
+        StableSet() = default;
+
+        ~StableSet()
+        {
+            Clear();
+        }
+
+        StableSet(const StableSet&) = delete;
+        StableSet& operator=(const StableSet&) = delete;
+
+        StableSet(StableSet&& other) noexcept
+            : Pages(std::move(other.Pages)), Sparse(std::move(other.Sparse)), ReverseMapping(std::move(other.ReverseMapping)), Occupied(std::move(other.Occupied)), FreeSlots(std::move(other.FreeSlots)), Count(std::exchange(other.Count, 0))
+        {
+        }
+
+        StableSet& operator=(StableSet&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Clear();
+
+                Pages = std::move(other.Pages);
+                Sparse = std::move(other.Sparse);
+                ReverseMapping = std::move(other.ReverseMapping);
+                Occupied = std::move(other.Occupied);
+                FreeSlots = std::move(other.FreeSlots);
+                Count = std::exchange(other.Count, 0);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, const Type& element)
+        {
+            return Emplace(index, element);
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Insert(SizeType index, Type&& element)
+        {
+            return Emplace(index, std::move(element));
+        }
+
+        template <typename... TArgs>
+        [[nodiscard]] inline ReferenceResult<Type> Emplace(SizeType index, TArgs&&... args)
+        {
+            if (index >= Sparse.size())
+            {
+                Sparse.resize(index + 1, DeadIndex);
+            }
+
+            if (Sparse[index] != DeadIndex)
+            {
+                return ReferenceResult<Type>(&Slot(Sparse[index]), false);
+            }
+
+            SizeType slot = AcquireSlot();
+
+            ::new (static_cast<void*>(SlotAddress(slot))) Type(std::forward<TArgs>(args)...);
+
+            Sparse[index] = slot;
+            ReverseMapping[slot] = index;
+            Occupied[slot / 64] |= std::uint64_t(1) << (slot % 64);
+            Count++;
+
+            return ReferenceResult<Type>(&Slot(slot), true);
+        }
+
+        [[nodiscard]] inline bool Remove(SizeType index)
+        {
+            if (index >= Sparse.size() || Sparse[index] == DeadIndex)
+            {
+                return false;
+            }
+
+            SizeType slot = Sparse[index];
+
+            std::destroy_at(&Slot(slot));
+
+            Sparse[index] = DeadIndex;
+            ReverseMapping[slot] = DeadIndex;
+            Occupied[slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+            FreeSlots.push_back(slot);
+            Count--;
+
+            return true;
+        }
+
+        [[nodiscard]] inline ReferenceResult<Type> Get(SizeType index)
+        {
+            if (index >= Sparse.size() || Sparse[index] == DeadIndex)
+            {
+                return ReferenceResult<Type>(nullptr, false);
+            }
+
+            return ReferenceResult<Type>(&Slot(Sparse[index]), true);
+        }
+
+        [[nodiscard]] inline ReferenceResult<const Type> Get(SizeType index) const
+        {
+            if (index >= Sparse.size() || Sparse[index] == DeadIndex)
+            {
+                return ReferenceResult<const Type>(nullptr, false);
+            }
+
+            return ReferenceResult<const Type>(&Slot(Sparse[index]), true);
+        }
+
+        [[nodiscard]] inline Type& GetUnchecked(SizeType index)
+        {
+            return Slot(Sparse[index]);
+        }
+
+        [[nodiscard]] inline const Type& GetUnchecked(SizeType index) const
+        {
+            return Slot(Sparse[index]);
+        }
+
+        [[nodiscard]] inline bool Contains(SizeType index) const
+        {
+            return index < Sparse.size() && Sparse[index] != DeadIndex;
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function)
+        {
+            for (SizeType slot = NextOccupied(0); slot < ReverseMapping.size(); slot = NextOccupied(slot + 1))
+            {
+                function(ReverseMapping[slot], Slot(slot));
+            }
+        }
+
+        template <typename TFunction>
+        inline void ForEach(TFunction&& function) const
+        {
+            for (SizeType slot = NextOccupied(0); slot < ReverseMapping.size(); slot = NextOccupied(slot + 1))
+            {
+                function(ReverseMapping[slot], Slot(slot));
+            }
+        }
+
+        inline void Fill(const std::vector<SizeType>& indices, const Type& element)
+        {
+            for (const SizeType& index : indices)
+            {
+                static_cast<void>(Emplace(index, element));
+            }
+        }
+
+        template <typename TRemap>
+        inline void Merge(StableSet& other, TRemap&& remap)
+        {
+            other.ForEach([this, &remap](SizeType index, Type& element)
+            {
+                static_cast<void>(Emplace(remap(index), std::move(element)));
+            });
+
+            other.Clear();
+        }
+
+        inline void Arrange(const std::vector<SizeType>&)
+        {
+        }
+
+        inline void Compact()
+        {
+            if (Count == ReverseMapping.size())
+            {
+                return;
+            }
+
+            SizeType hole = 0;
+            SizeType tail = ReverseMapping.size();
+
+            while (true)
+            {
+                while (hole < tail && ReverseMapping[hole] != DeadIndex)
+                {
+                    hole++;
+                }
+
+                while (tail > hole && ReverseMapping[tail - 1] == DeadIndex)
+                {
+                    tail--;
+                }
+
+                if (hole + 1 >= tail)
+                {
+                    break;
+                }
+
+                SizeType from = tail - 1;
+                SizeType index = ReverseMapping[from];
+
+                ::new (static_cast<void*>(SlotAddress(hole))) Type(std::move(Slot(from)));
+                std::destroy_at(&Slot(from));
+
+                ReverseMapping[hole] = index;
+                ReverseMapping[from] = DeadIndex;
+                Sparse[index] = hole;
+
+                tail--;
+            }
+
+            ReverseMapping.resize(Count);
+            Occupied.assign((Count + 63) / 64, 0);
+
+            for (SizeType slot = 0; slot < Count; slot++)
+            {
+                Occupied[slot / 64] |= std::uint64_t(1) << (slot % 64);
+            }
+
+            FreeSlots.clear();
+            Pages.resize((Count + PageSize - 1) / PageSize);
+        }
+
+        [[nodiscard]] inline Iterator begin() noexcept
+        {
+            return Iterator(this, 0);
+        }
+
+        [[nodiscard]] inline ConstIterator begin() const noexcept
+        {
+            return ConstIterator(this, 0);
+        }
+
+        [[nodiscard]] inline Iterator end() noexcept
+        {
+            return Iterator(this, ReverseMapping.size());
+        }
+
+        [[nodiscard]] inline ConstIterator end() const noexcept
+        {
+            return ConstIterator(this, ReverseMapping.size());
+        }
+
+        [[nodiscard]] inline const std::vector<TSizeType>& GetSparse() const
+        {
+            return Sparse;
+        }
+
+        [[nodiscard]] inline const std::vector<TSizeType>& GetReverseMapping() const
+        {
+            return ReverseMapping;
+        }
+
+        [[nodiscard]] inline SizeType Size() const
+        {
+            return Count;
+        }
+
+        [[nodiscard]] inline SizeType SlotCount() const
+        {
+            return ReverseMapping.size();
+        }
+
+        [[nodiscard]] inline bool Empty() const
+        {
+            return Count == 0;
+        }
+
+        inline void Clear()
+        {
+            for (SizeType slot = NextOccupied(0); slot < ReverseMapping.size(); slot = NextOccupied(slot + 1))
+            {
+                std::destroy_at(&Slot(slot));
+            }
+
+            Pages.clear();
+            Sparse.clear();
+            ReverseMapping.clear();
+            Occupied.clear();
+            FreeSlots.clear();
+
+            Count = 0;
+        }
+
+        inline void Reserve(SizeType count)
+        {
+            ReverseMapping.reserve(count);
+            Occupied.reserve((count + 63) / 64);
+
+            while (Pages.size() * PageSize < count)
+            {
+                Pages.push_back(std::make_unique<Page>());
+            }
+        }
+
+        inline void Trim()
+        {
+            if (FreeSlots.capacity() > 64 && FreeSlots.size() * 4 < FreeSlots.capacity())
+            {
+                FreeSlots.shrink_to_fit();
+            }
+
+            if (Sparse.size() > 64 && Count * 4 < Sparse.size())
+            {
+                while (!Sparse.empty() && Sparse.back() == DeadIndex)
+                {
+                    Sparse.pop_back();
+                }
+
+                if (Sparse.size() * 4 < Sparse.capacity())
+                {
+                    Sparse.shrink_to_fit();
+                }
+            }
+        }
+
+        [[nodiscard]] inline std::size_t MemoryUsage() const
+        {
+            return Pages.size() * sizeof(Page) + (Sparse.capacity() + ReverseMapping.capacity() + FreeSlots.capacity()) * sizeof(SizeType) + Occupied.capacity() * sizeof(std::uint64_t);
+        }
+
+        inline void ShrinkToFit()
+        {
+            Sparse.shrink_to_fit();
+            ReverseMapping.shrink_to_fit();
+            Occupied.shrink_to_fit();
+            FreeSlots.shrink_to_fit();
+        }
+
+    private:
+        struct Page
+        {
+            alignas(Type) std::byte Data[sizeof(Type) * PageSize];
+        };
+
+        [[nodiscard]] inline Type* SlotAddress(SizeType slot) const
+        {
+            return reinterpret_cast<Type*>(Pages[slot / PageSize]->Data) + slot % PageSize;
+        }
+
+        [[nodiscard]] inline Type& Slot(SizeType slot)
+        {
+            return *std::launder(SlotAddress(slot));
+        }
+
+        [[nodiscard]] inline const Type& Slot(SizeType slot) const
+        {
+            return *std::launder(SlotAddress(slot));
+        }
+
+        [[nodiscard]] inline SizeType NextOccupied(SizeType slot) const
+        {
+            SizeType end = ReverseMapping.size();
+
+            if (slot >= end)
+            {
+                return end;
+            }
+
+            SizeType word = slot / 64;
+            std::uint64_t bits = Occupied[word] & (~std::uint64_t(0) << (slot % 64));
+
+            while (bits == 0)
+            {
+                if (++word >= Occupied.size())
+                {
+                    return end;
+                }
+
+                bits = Occupied[word];
+            }
+
+            SizeType next = word * 64 + std::countr_zero(bits);
+
+            return next < end ? next : end;
+        }
+
+        [[nodiscard]] inline SizeType AcquireSlot()
+        {
+            if (!FreeSlots.empty())
+            {
+                SizeType slot = FreeSlots.back();
+
+                FreeSlots.pop_back();
+
+                return slot;
+            }
+
+            SizeType slot = ReverseMapping.size();
+
+            if (slot / PageSize >= Pages.size())
+            {
+                Pages.push_back(std::make_unique<Page>());
+            }
+
+            ReverseMapping.push_back(DeadIndex);
+
+            if (slot / 64 >= Occupied.size())
+            {
+                Occupied.push_back(0);
+            }
+
+            return slot;
+        }
+
+        std::vector<std::unique_ptr<Page>> Pages;
+
+        std::vector<SizeType> Sparse;
+        std::vector<SizeType> ReverseMapping;
+        std::vector<std::uint64_t> Occupied;
+        std::vector<SizeType> FreeSlots;
+
+        SizeType Count = 0;
+    };
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace minECS
 {
@@ -26,8 +28,189 @@ namespace minECS
     template <typename TComponent, typename... TOthers>
     inline constexpr bool ComponentsAreUnique<TComponent, TOthers...> = (!std::is_same_v<TComponent, TOthers> && ...) && ComponentsAreUnique<TOthers...>;
 
+    template <typename T, typename TSizeType, typename TDense = std::vector<T>, typename TIndex = std::vector<TSizeType>>
+    requires IsSizeType<TSizeType>
+    class SparseSet;
+
+    template <typename T>
+    class HugePageAllocator;
+
+    template <typename T>
+    using HugePageVector = std::vector<T, HugePageAllocator<T>>;
+
+    template <typename, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class StableSet;
+
+    template <typename, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class DoubleBufferedSet;
+
+    template <typename, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class DirectSet;
+
+    template <typename, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    class PagedSet;
+
+    template <typename TComponent>
+    struct Stable
+    {
+    };
+
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    class MappedVector;
+
+    template <typename TComponent>
+    struct DoubleBuffered
+    {
+    };
+
+    template <typename TComponent>
+    struct Mapped
+    {
+    };
+
+    template <typename TComponent>
+    struct Direct
+    {
+    };
+
+    template <typename TComponent>
+    struct Paged
+    {
+    };
+
+    template <typename TComponent>
+    struct HugePages
+    {
+    };
+
+    template <typename TDeclaration>
+    struct ComponentDeclaration
+    {
+        using Type = TDeclaration;
+
+#if defined(MINECS_ENABLE_HUGE_PAGES)
+        template <typename TSizeType>
+        using StorageType = SparseSet<Type, TSizeType, HugePageVector<Type>, HugePageVector<TSizeType>>;
+#else
+        template <typename TSizeType>
+        using StorageType = SparseSet<Type, TSizeType>;
+#endif
+    };
+
+    template <typename TComponent>
+    struct ComponentDeclaration<Stable<TComponent>>
+    {
+        using Type = TComponent;
+
+        template <typename TSizeType>
+        using StorageType = StableSet<Type, TSizeType>;
+    };
+
+    template <typename TComponent>
+    struct ComponentDeclaration<DoubleBuffered<TComponent>>
+    {
+        using Type = TComponent;
+
+        template <typename TSizeType>
+        using StorageType = DoubleBufferedSet<Type, TSizeType>;
+    };
+
+    template <typename TComponent>
+    struct ComponentDeclaration<Mapped<TComponent>>
+    {
+        using Type = TComponent;
+
+#if defined(__unix__) || defined(__APPLE__)
+        template <typename TSizeType>
+        using StorageType = SparseSet<Type, TSizeType, MappedVector<Type>>;
+#else
+        template <typename TSizeType>
+        using StorageType = SparseSet<Type, TSizeType>;
+#endif
+    };
+
+    template <typename TComponent>
+    struct ComponentDeclaration<Direct<TComponent>>
+    {
+        using Type = TComponent;
+
+        template <typename TSizeType>
+        using StorageType = DirectSet<Type, TSizeType>;
+    };
+
+    template <typename TComponent>
+    struct ComponentDeclaration<Paged<TComponent>>
+    {
+        using Type = TComponent;
+
+        template <typename TSizeType>
+        using StorageType = PagedSet<Type, TSizeType>;
+    };
+
+    template <typename TComponent>
+    struct ComponentDeclaration<HugePages<TComponent>>
+    {
+        using Type = TComponent;
+
+        template <typename TSizeType>
+        using StorageType = SparseSet<Type, TSizeType, HugePageVector<Type>, HugePageVector<TSizeType>>;
+    };
+
+    template <typename TDeclaration>
+    using ComponentTypeOf = typename ComponentDeclaration<TDeclaration>::Type;
+
+    template <typename TDeclaration, typename TSizeType>
+    using ComponentStorageOf = typename ComponentDeclaration<TDeclaration>::template StorageType<TSizeType>;
+
+    template <typename TComponent, typename... TComponents>
+    inline constexpr bool PackContains = (std::is_same_v<TComponent, TComponents> || ...);
+
+    template <typename... TComponents>
+    requires ComponentsAreUnique<TComponents...> && CanBeComponents<TComponents...> && (sizeof...(TComponents) != 0)
+    struct Archetype
+    {
+    };
+
+    template <typename>
+    inline constexpr bool IsArchetype = false;
+
+    template <typename... TComponents>
+    inline constexpr bool IsArchetype<Archetype<TComponents...>> = true;
+
+    template <typename TArchetype, typename... TQueried>
+    inline constexpr bool ArchetypeMatches = false;
+
+    template <typename... TComponents, typename... TQueried>
+    inline constexpr bool ArchetypeMatches<Archetype<TComponents...>, TQueried...> = sizeof...(TComponents) == sizeof...(TQueried) && ComponentsAreUnique<TQueried...> && (PackContains<TQueried, TComponents...> && ...);
+
+    template <typename TArchetype, typename... TQueried>
+    inline constexpr bool ArchetypeHasComponents = false;
+
+    template <typename... TComponents, typename... TQueried>
+    inline constexpr bool ArchetypeHasComponents<Archetype<TComponents...>, TQueried...> = (PackContains<TQueried, TComponents...> && ...);
+
+    template <typename TDeclaration, typename... TDeclared>
+    inline constexpr bool ArchetypeIsDeclared = true;
+
+    template <typename... TComponents, typename... TDeclared>
+    inline constexpr bool ArchetypeIsDeclared<Archetype<TComponents...>, TDeclared...> = (PackContains<TComponents, TDeclared...> && ...);
+
+    template <typename TTuple, template <typename> typename TTransform>
+    struct TransformTuple;
+
+    template <typename... Ts, template <typename> typename TTransform>
+    struct TransformTuple<std::tuple<Ts...>, TTransform>
+    {
+        using Type = std::tuple<TTransform<Ts>...>;
+    };
+
     template <typename TSizeType, typename... TComponents>
-    requires ComponentsAreUnique<TComponents...> && CanBeComponents<TComponents...> && IsSizeType<TSizeType>
+    requires ComponentsAreUnique<ComponentTypeOf<TComponents>...> && CanBeComponents<ComponentTypeOf<TComponents>...> && IsSizeType<TSizeType>
     class ECSDescriptor;
 
     template <typename>
@@ -61,14 +244,47 @@ namespace minECS
     requires IsSizeType<TSizeType> && (NBitsetSize > 0)
     inline constexpr bool IsBitsetTree<BitsetTree<T, TSizeType, NBitsetSize>> = true;
 
-    template <typename, typename TSizeType>
+    template <typename>
+    inline constexpr bool IsSparseSet = false;
+
+    template <typename T, typename TSizeType, typename TDense, typename TIndex>
     requires IsSizeType<TSizeType>
-    class SparseSet;
+    inline constexpr bool IsSparseSet<SparseSet<T, TSizeType, TDense, TIndex>> = true;
 
     template <typename>
-    inline constexpr bool IsSparseSet = false;
+    inline constexpr bool IsStableSet = false;
+
+    template <typename T, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    inline constexpr bool IsStableSet<StableSet<T, TSizeType>> = true;
+
+    template <typename>
+    inline constexpr bool IsDoubleBufferedSet = false;
 
     template <typename T, typename TSizeType>
     requires IsSizeType<TSizeType>
-    inline constexpr bool IsSparseSet<SparseSet<T, TSizeType>> = true;
+    inline constexpr bool IsDoubleBufferedSet<DoubleBufferedSet<T, TSizeType>> = true;
+
+    template <typename>
+    inline constexpr bool IsDirectSet = false;
+
+    template <typename T, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    inline constexpr bool IsDirectSet<DirectSet<T, TSizeType>> = true;
+
+    template <typename>
+    inline constexpr bool IsPagedSet = false;
+
+    template <typename T, typename TSizeType>
+    requires IsSizeType<TSizeType>
+    inline constexpr bool IsPagedSet<PagedSet<T, TSizeType>> = true;
+
+    template <typename TStorage>
+    inline void MarkStorageWritten(TStorage& storage)
+    {
+        if constexpr (IsDoubleBufferedSet<TStorage>)
+        {
+            storage.MarkWritten();
+        }
+    }
 }
\ No newline at end of file
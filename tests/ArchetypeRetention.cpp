@@ -0,0 +1,107 @@
+#include <minECS/minECS.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+struct Position
+{
+    int X;
+};
+
+struct Velocity
+{
+    int X;
+};
+
+struct Tag
+{
+    int X;
+};
+
+using Descriptor = minECS::ECSDescriptor<std::uint32_t, Position, Velocity, Tag>;
+using World = minECS::ECS<Descriptor>;
+
+template <typename... TQueried>
+static std::size_t CountArchetypes(World& world)
+{
+    std::size_t count = 0;
+
+    world.ForEachArchetype<TQueried...>([&](const auto& mask, auto&)
+    {
+        count += mask.count() == sizeof...(TQueried);
+    });
+
+    return count;
+}
+
+template <typename... TQueried>
+static std::size_t ArchetypeMemory(World& world)
+{
+    std::size_t memory = 0;
+
+    world.ForEachArchetype<TQueried...>([&](const auto& mask, auto& archetype)
+    {
+        if (mask.count() == sizeof...(TQueried))
+        {
+            memory += archetype.MemoryUsage();
+        }
+    });
+
+    return memory;
+}
+
+static void UnreserveReleasesArchetype()
+{
+    World world;
+
+    world.SetArchetypeRetention(1);
+    world.ReserveArchetype<Position, Velocity>(1000);
+
+    for (int i = 0; i < 4; i++)
+    {
+        world.CollectGarbage();
+    }
+
+    assert((CountArchetypes<Position, Velocity>(world) == 1));
+
+    world.UnreserveArchetype<Position, Velocity>();
+
+    for (int i = 0; i < 4; i++)
+    {
+        world.CollectGarbage();
+    }
+
+    assert((CountArchetypes<Position, Velocity>(world) == 0));
+}
+
+static void ReservedArchetypesAreOutsideBudget()
+{
+    World world;
+
+    world.SetArchetypeRetention(100);
+    world.ReserveArchetype<Position, Velocity>(1000);
+
+    World::EntityType tagged = world.CreateEntity(Tag{1}).GetValue();
+    World::EntityType moving = world.CreateEntity(Position{1}, Velocity{1}).GetValue();
+
+    assert(world.DestroyEntity(tagged));
+
+    world.CollectGarbage();
+
+    assert(world.DestroyEntity(moving));
+
+    world.SetArchetypeRetention(100, ArchetypeMemory<Tag>(world));
+    world.CollectGarbage();
+
+    assert((CountArchetypes<Position, Velocity>(world) == 1));
+    assert(CountArchetypes<Tag>(world) == 1);
+}
+
+int main()
+{
+    UnreserveReleasesArchetype();
+    ReservedArchetypesAreOutsideBudget();
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <minECS/minECS.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+struct Name
+{
+    std::string Value;
+};
+
+struct Position
+{
+    int X;
+};
+
+using Descriptor = minECS::ECSDescriptor<std::uint32_t, Position, minECS::Direct<Name>>;
+using World = minECS::ECS<Descriptor>;
+
+static void CloneGrowsPastSource()
+{
+    World world;
+
+    World::EntityType source = world.CreateEntity(Position{1}, Name{std::string(64, 'n')}).GetValue();
+
+    std::vector<World::EntityType> clones = world.CloneEntity(source, 1000);
+
+    assert(clones.size() == 1000);
+
+    for (const World::EntityType& clone : clones)
+    {
+        assert(world.GetSparseSet<Name>().Get(clone.GetID()).GetValue().Value == std::string(64, 'n'));
+    }
+}
+
+static void InstantiateGrowsPastPrefab()
+{
+    World world;
+
+    World::EntityType source = world.CreateEntity(Position{2}, Name{std::string(64, 'p')}).GetValue();
+    std::uint32_t prefab = world.CreatePrefabFromEntity(source).GetValue();
+
+    std::vector<World::EntityType> instances = world.Instantiate(prefab, 1000);
+
+    assert(instances.size() == 1000);
+
+    for (const World::EntityType& instance : instances)
+    {
+        assert(world.GetSparseSet<Name>().Get(instance.GetID()).GetValue().Value == std::string(64, 'p'));
+    }
+}
+
+static void EmplaceFromOwnElement()
+{
+    minECS::DirectSet<Name, std::uint32_t> set;
+
+    static_cast<void>(set.Insert(0, Name{std::string(64, 'e')}));
+
+    const Name& element = set.Get(0).GetValue();
+
+    static_cast<void>(set.Insert(100000, element));
+
+    assert(set.Get(100000).GetValue().Value == std::string(64, 'e'));
+    assert(set.Size() == 2);
+}
+
+int main()
+{
+    CloneGrowsPastSource();
+    InstantiateGrowsPastPrefab();
+    EmplaceFromOwnElement();
+
+    return 0;
+}
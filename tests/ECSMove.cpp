@@ -0,0 +1,85 @@
+#include <minECS/minECS.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+struct Position
+{
+    int X;
+};
+
+struct Velocity
+{
+    int X;
+};
+
+using Descriptor = minECS::ECSDescriptor<std::uint32_t, Position, Velocity, minECS::Archetype<Position, Velocity>>;
+using World = minECS::ECS<Descriptor>;
+
+static int CountMoving(World& world)
+{
+    int count = 0;
+
+    world.ForEach<Position, Velocity>([&](World::EntityType, Position& position, Velocity& velocity)
+    {
+        assert(position.X == velocity.X);
+
+        count++;
+    });
+
+    return count;
+}
+
+static void MovedFromIsUsable(World& world)
+{
+    assert(CountMoving(world) == 0);
+
+    World::EntityType entity = world.CreateEntity(Position{7}, Velocity{7}).GetValue();
+
+    assert(world.HasEntity(entity));
+    assert(CountMoving(world) == 1);
+}
+
+static void MoveConstructedSourceKeepsDeclaredArchetypes()
+{
+    World source;
+
+    for (int i = 0; i < 10; i++)
+    {
+        static_cast<void>(source.CreateEntity(Position{i}, Velocity{i}).GetValue());
+    }
+
+    World target(std::move(source));
+
+    assert(CountMoving(target) == 10);
+
+    MovedFromIsUsable(source);
+}
+
+static void MoveAssignedSourceKeepsDeclaredArchetypes()
+{
+    World source;
+    World target;
+
+    for (int i = 0; i < 10; i++)
+    {
+        static_cast<void>(source.CreateEntity(Position{i}, Velocity{i}).GetValue());
+    }
+
+    static_cast<void>(target.CreateEntity(Position{1}, Velocity{1}).GetValue());
+
+    target = std::move(source);
+
+    assert(CountMoving(target) == 10);
+
+    MovedFromIsUsable(source);
+}
+
+int main()
+{
+    MoveConstructedSourceKeepsDeclaredArchetypes();
+    MoveAssignedSourceKeepsDeclaredArchetypes();
+
+    return 0;
+}
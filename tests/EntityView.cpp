@@ -0,0 +1,91 @@
+#include <minECS/minECS.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+struct Position
+{
+    int X;
+};
+
+struct Velocity
+{
+    int X;
+};
+
+using Descriptor = minECS::ECSDescriptor<std::uint32_t, Position, Velocity>;
+using World = minECS::ECS<Descriptor>;
+
+static void ViewSkipsDisabledRows()
+{
+    World world;
+
+    std::vector<World::EntityType> entities;
+
+    for (int i = 0; i < 200; i++)
+    {
+        entities.push_back(world.CreateEntity(Position{i}, Velocity{i}).GetValue());
+    }
+
+    for (int i = 0; i < 200; i += 3)
+    {
+        assert(world.SetEntityEnabled(entities[i], false));
+    }
+
+    world.ForEachArchetype<Position, Velocity>([&](const auto&, World::ArchetypeType& archetype)
+    {
+        auto view = world.GetEntityView<Position, Velocity>(archetype);
+
+        assert(view.Size() == 133);
+        assert(view.end() - view.begin() == 133);
+
+        std::vector<int> visits(200, 0);
+
+        std::for_each(view.begin(), view.end(), [&](auto components)
+        {
+            auto& [entity, position, velocity] = components;
+
+            assert(world.IsEntityEnabled(entity));
+            assert(position.X == velocity.X);
+
+            visits[position.X]++;
+        });
+
+        for (int i = 0; i < 200; i++)
+        {
+            assert(visits[i] == (i % 3 == 0 ? 0 : 1));
+        }
+
+        for (World::SizeType index = 0; index < view.Size(); index++)
+        {
+            assert(world.IsEntityEnabled(std::get<0>(view[index])));
+        }
+
+        assert((world.GetEntityView<Position, Velocity>(archetype, true).Size() == 200));
+    });
+}
+
+static void ViewWithoutDisabledRowsCoversArchetype()
+{
+    World world;
+
+    for (int i = 0; i < 10; i++)
+    {
+        static_cast<void>(world.CreateEntity(Position{i}, Velocity{i}).GetValue());
+    }
+
+    world.ForEachArchetype<Position, Velocity>([&](const auto&, World::ArchetypeType& archetype)
+    {
+        assert((world.GetEntityView<Position, Velocity>(archetype).Size() == 10));
+    });
+}
+
+int main()
+{
+    ViewSkipsDisabledRows();
+    ViewWithoutDisabledRowsCoversArchetype();
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <minECS/minECS.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+struct Position
+{
+    int X;
+};
+
+struct Velocity
+{
+    int X;
+};
+
+struct Tag
+{
+    int X;
+};
+
+using Descriptor = minECS::ECSDescriptor<std::uint32_t, Position, Velocity, Tag>;
+using World = minECS::ECS<Descriptor>;
+
+static void RemoveAndMigrateMidPass()
+{
+    World world;
+
+    std::vector<World::EntityType> entities;
+
+    for (int i = 0; i < 100; i++)
+    {
+        entities.push_back(world.CreateEntity(Position{i}, Velocity{i}).GetValue());
+    }
+
+    for (int i = 0; i < 20; i++)
+    {
+        static_cast<void>(world.CreateEntity(Position{i}).GetValue());
+    }
+
+    std::vector<int> visits(world.GetEntitySlotCount(), 0);
+
+    auto cursor = world.MakeCursor<Position, Velocity>();
+    auto visit = [&](World::EntityType entity, Position&, Velocity&)
+    {
+        visits[entity.GetID()]++;
+    };
+
+    assert(!cursor.Step(world, 50, visit));
+
+    assert(world.DestroyEntity(entities[10]));
+    assert(world.DestroyEntity(entities[60]));
+
+    for (int i = 70; i < 80; i++)
+    {
+        assert(world.AddComponentToEntity(entities[i], Tag{i}));
+    }
+
+    assert(world.RemoveComponentFromEntity<Velocity>(entities[80]));
+    assert(world.AddComponentToEntity(entities[80], Velocity{80}));
+
+    assert(world.RemoveComponentFromEntity<Tag>(entities[75]));
+
+    world.CompactStorage();
+
+    assert(cursor.Step(world, 1000, visit));
+    assert(cursor.GetPassCount() == 1);
+
+    for (int i = 0; i < 100; i++)
+    {
+        assert(visits[entities[i].GetID()] == (i == 60 ? 0 : 1));
+    }
+
+    assert(visits[entities[99].GetID()] == 1);
+}
+
+static void DisabledEntitiesAreSkipped()
+{
+    World world;
+
+    std::vector<World::EntityType> entities;
+
+    for (int i = 0; i < 10; i++)
+    {
+        entities.push_back(world.CreateEntity(Position{i}, Velocity{i}).GetValue());
+    }
+
+    assert(world.SetEntityEnabled(entities[3], false));
+
+    int count = 0;
+
+    auto cursor = world.MakeCursor<Position, Velocity>();
+
+    assert(cursor.Step(world, 1000, [&](World::EntityType entity, Position&, Velocity&)
+    {
+        assert(entity.GetID() != entities[3].GetID());
+
+        count++;
+    }));
+
+    assert(count == 9);
+}
+
+int main()
+{
+    RemoveAndMigrateMidPass();
+    DisabledEntitiesAreSkipped();
+
+    return 0;
+}